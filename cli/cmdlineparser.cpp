@@ -522,6 +522,17 @@ CmdLineParser::Result CmdLineParser::parseFromArgs(int argc, const char* const a
             mAnalyzeAllVsConfigsSetOnCmdLine = true;
         }
 
+        else if (std::strncmp(argv[i], "--cache-dir=", 12) == 0) {
+            std::string path = Path::fromNativeSeparators(argv[i] + 12);
+            if (path.empty()) {
+                mLogger.printError("no path has been specified for --cache-dir");
+                return Result::Fail;
+            }
+            if (endsWith(path, '/'))
+                path.pop_back();
+            mSettings.cacheDir = std::move(path);
+        }
+
         // Check configuration
         else if (std::strcmp(argv[i], "--check-config") == 0)
             mSettings.checkConfiguration = true;
@@ -566,6 +577,26 @@ CmdLineParser::Result CmdLineParser::parseFromArgs(int argc, const char* const a
             }
         }
 
+        else if (std::strncmp(argv[i], "--checkers-jobs=", 16) == 0) {
+#if defined(HAS_THREADING_MODEL_THREAD)
+            unsigned int tmp;
+            if (!parseNumberArg(argv[i], 16, tmp))
+                return Result::Fail;
+            if (tmp == 0) {
+                mLogger.printError("argument for '--checkers-jobs' must be greater than 0.");
+                return Result::Fail;
+            }
+            if (tmp > 1024) {
+                mLogger.printError("argument for '--checkers-jobs' is allowed to be 1024 at max.");
+                return Result::Fail;
+            }
+            mSettings.checkersJobs = tmp;
+#else
+            mLogger.printError("Option --checkers-jobs cannot be used as Cppcheck has not been built with a respective threading model.");
+            return Result::Fail;
+#endif
+        }
+
         else if (std::strncmp(argv[i], "--checkers-report=", 18) == 0)
             mSettings.checkersReportFilename = argv[i] + 18;
 
@@ -605,6 +636,40 @@ CmdLineParser::Result CmdLineParser::parseFromArgs(int argc, const char* const a
             }
         }
 
+        else if (std::strncmp(argv[i], "--config-jobs=", 14) == 0) {
+#if defined(HAS_THREADING_MODEL_THREAD)
+            unsigned int tmp;
+            if (!parseNumberArg(argv[i], 14, tmp))
+                return Result::Fail;
+            if (tmp == 0) {
+                mLogger.printError("argument for '--config-jobs' must be greater than 0.");
+                return Result::Fail;
+            }
+            if (tmp > 1024) {
+                mLogger.printError("argument for '--config-jobs' is allowed to be 1024 at max.");
+                return Result::Fail;
+            }
+            mSettings.configJobs = tmp;
+#else
+            mLogger.printError("Option --config-jobs cannot be used as Cppcheck has not been built with a respective threading model.");
+            return Result::Fail;
+#endif
+        }
+
+        // Hand out the files to workers connecting on the given address
+        else if (std::strncmp(argv[i], "--coordinator=", 14) == 0) {
+#ifdef HAS_THREADING_MODEL_FORK
+            mSettings.coordinator = argv[i] + 14;
+            if (mSettings.coordinator.empty()) {
+                mLogger.printError("no address has been specified for --coordinator");
+                return Result::Fail;
+            }
+#else
+            mLogger.printError("Option --coordinator cannot be used as Cppcheck has not been built with fork threading model.");
+            return Result::Fail;
+#endif
+        }
+
         else if (std::strncmp(argv[i], "--cppcheck-build-dir=", 21) == 0) {
             std::string path = Path::fromNativeSeparators(argv[i] + 21);
             if (path.empty()) {
@@ -750,6 +815,15 @@ CmdLineParser::Result CmdLineParser::parseFromArgs(int argc, const char* const a
 #else
                 mLogger.printError("executor type 'process' cannot be used as Cppcheck has not been built with a respective threading model.");
                 return Result::Fail;
+#endif
+            }
+            else if (type == "process-pool") {
+#if defined(HAS_THREADING_MODEL_FORK)
+                executorAuto = false;
+                mSettings.executor = Settings::ExecutorType::ProcessPool;
+#else
+                mLogger.printError("executor type 'process-pool' cannot be used as Cppcheck has not been built with a respective threading model.");
+                return Result::Fail;
 #endif
             }
             else {
@@ -1001,6 +1075,23 @@ CmdLineParser::Result CmdLineParser::parseFromArgs(int argc, const char* const a
             mSettings.maxCtuDepth = temp;
         }
 
+        // Limit the estimated memory usage of the processes analyzing files simultaneously
+        else if (std::strncmp(argv[i], "--max-memory=", 13) == 0) {
+#ifdef HAS_THREADING_MODEL_FORK
+            unsigned int tmp;
+            if (!parseNumberArg(argv[i], 13, tmp))
+                return Result::Fail;
+            if (tmp == 0) {
+                mLogger.printError("argument for '--max-memory' must be greater than 0.");
+                return Result::Fail;
+            }
+            mSettings.maxMemory = tmp;
+#else
+            mLogger.printError("Option --max-memory cannot be used as Cppcheck has not been built with fork threading model.");
+            return Result::Fail;
+#endif
+        }
+
         else if (std::strncmp(argv[i], "--max-template-recursion=", 25) == 0) {
             if (!parseNumberArg(argv[i], 25, mSettings.maxTemplateRecursion))
                 return Result::Fail;
@@ -1572,6 +1663,20 @@ CmdLineParser::Result CmdLineParser::parseFromArgs(int argc, const char* const a
         else if (std::strcmp(argv[i], "-v") == 0 || std::strcmp(argv[i], "--verbose") == 0)
             mSettings.verbose = true;
 
+        // Check the files handed out by the coordinator on the given address
+        else if (std::strncmp(argv[i], "--worker=", 9) == 0) {
+#ifdef HAS_THREADING_MODEL_FORK
+            mSettings.worker = argv[i] + 9;
+            if (mSettings.worker.empty()) {
+                mLogger.printError("no address has been specified for --worker");
+                return Result::Fail;
+            }
+#else
+            mLogger.printError("Option --worker cannot be used as Cppcheck has not been built with fork threading model.");
+            return Result::Fail;
+#endif
+        }
+
         // Write results in results.xml
         else if (std::strcmp(argv[i], "--xml") == 0) {
             if (outputFormatOptionProvided) {
@@ -1616,6 +1721,11 @@ CmdLineParser::Result CmdLineParser::parseFromArgs(int argc, const char* const a
     if (!executorAuto && mSettings.useSingleJob())
         mLogger.printMessage("'--executor' has no effect as only a single job will be used.");
 
+#ifdef HAS_THREADING_MODEL_FORK
+    if (mSettings.maxMemory > 0 && !mSettings.useSingleJob() && mSettings.executor == Settings::ExecutorType::Thread)
+        mLogger.printMessage("'--max-memory' has no effect with the thread executor.");
+#endif
+
     // Default template format..
     if (mSettings.templateFormat.empty()) {
         mSettings.templateFormat = "{bold}{file}:{line}:{column}: {red}{inconclusive:{magenta}}{severity}:{inconclusive: inconclusive:}{default} {message} [{id}]{reset}\\n{code}";
@@ -1701,6 +1811,42 @@ CmdLineParser::Result CmdLineParser::parseFromArgs(int argc, const char* const a
         return Result::Fail;
     }
 
+    if (!mSettings.cacheDir.empty()) {
+        if (!Path::isDirectory(mSettings.cacheDir)) {
+            mLogger.printError("Directory '" + mSettings.cacheDir + "' specified by --cache-dir argument has to be existent.");
+            return Result::Fail;
+        }
+        // cached results are copied into the build dir so they are available for the whole program analysis
+        if (mSettings.buildDir.empty()) {
+            mLogger.printError("--cache-dir requires --cppcheck-build-dir.");
+            return Result::Fail;
+        }
+    }
+
+#ifdef HAS_THREADING_MODEL_FORK
+    if (!mSettings.coordinator.empty() || !mSettings.worker.empty()) {
+        const std::string option = mSettings.coordinator.empty() ? "--worker" : "--coordinator";
+        if (!mSettings.coordinator.empty() && !mSettings.worker.empty()) {
+            mLogger.printError("--coordinator cannot be used in conjunction with --worker.");
+            return Result::Fail;
+        }
+        // the whole program analysis is performed based on the analyzer information the workers send back
+        if (mSettings.buildDir.empty()) {
+            mLogger.printError(option + " requires --cppcheck-build-dir.");
+            return Result::Fail;
+        }
+    }
+
+    // the files are handed out by the coordinator
+    if (!mSettings.worker.empty()) {
+        if (!mPathNames.empty() || projectType != ImportProject::Type::NONE) {
+            mLogger.printError("--worker cannot be used in conjunction with source files.");
+            return Result::Fail;
+        }
+        return Result::Success;
+    }
+#endif
+
     // Print error only if we have "real" command and expect files
     if (mPathNames.empty() && project.guiProject.pathNames.empty() && project.fileSettings.empty()) {
         // TODO: this message differs from the one reported in fillSettingsFromArgs()
@@ -1760,6 +1906,18 @@ void CmdLineParser::printHelp() const
         "                         addon json files or through this command line option.\n"
         "                         If not present, Cppcheck will try \"python3\" first and\n"
         "                         then \"python\".\n"
+        "    --cache-dir=<dir>\n"
+        "                         Share the results with other build dirs using the same\n"
+        "                         cache directory (i.e. other checkouts or CI workers).\n"
+        "                         The results are keyed by the hash of the preprocessed\n"
+        "                         file and the path as it was given, so use relative\n"
+        "                         paths. Requires --cppcheck-build-dir.\n"
+        "    --coordinator=<address>\n"
+        "                         Hand out the files to the workers connecting on the\n"
+        "                         given address (see --worker) instead of checking them\n"
+        "                         locally. The whole program analysis is performed by\n"
+        "                         the coordinator. Requires --cppcheck-build-dir. The\n"
+        "                         address is either 'unix:<path>' or '<host>:<port>'.\n"
         "    --cppcheck-build-dir=<dir>\n"
         "                         Cppcheck work folder. Advantages:\n"
         "                          * whole program analysis\n"
@@ -1779,6 +1937,11 @@ void CmdLineParser::printHelp() const
         "                         The default choice is 'normal'.\n"
         "    --check-library      Show information messages when library files have\n"
         "                         incomplete info.\n"
+        "    --checkers-jobs=<jobs>\n"
+        "                         Start <jobs> threads to run the checkers of a single file\n"
+        "                         simultaneously. This reduces the time it takes to analyze\n"
+        "                         a single large file. The results are reported in the same\n"
+        "                         order as with a single thread.\n"
         "    --checkers-report=<file>\n"
         "                         Write a report of all the active checkers to the given file.\n"
         "    --clang=<path>       Experimental: Use Clang parser instead of the builtin Cppcheck\n"
@@ -1795,6 +1958,12 @@ void CmdLineParser::printHelp() const
         "                         be considered for evaluation.\n"
         "    --config-excludes-file=<file>\n"
         "                         A file that contains a list of config-excludes\n"
+        "    --config-jobs=<jobs>\n"
+        "                         Start <jobs> threads to tokenize and check the\n"
+        "                         preprocessor configurations of a single file\n"
+        "                         simultaneously. The preprocessing is still done on a\n"
+        "                         single thread. The results are reported in the same\n"
+        "                         order as with a single thread.\n"
         "    --disable=<severity> Disable checks with the given severity.\n"
         "                         Please refer to the documentation of --enable for\n"
         "                         further details.\n"
@@ -1901,6 +2070,11 @@ void CmdLineParser::printHelp() const
         "    --max-ctu-depth=N    Max depth in whole program analysis. The default value\n"
         "                         is 2. A larger value will mean more errors can be found\n"
         "                         but also means the analysis will be slower.\n"
+        "    --max-memory=<MiB>   Specifies that no new processes should be started if\n"
+        "                         there are other processes running and the estimated\n"
+        "                         memory usage would exceed <MiB>. The estimates are based\n"
+        "                         on the memory usage recorded for the files in the\n"
+        "                         build dir (if specified) and in the current run.\n"
         "    --output-file=<file> Write results to file, rather than standard error.\n"
         "    --output-format=<format>\n"
         "                        Specify the output format. The available formats are:\n"
@@ -2098,6 +2272,11 @@ void CmdLineParser::printHelp() const
         "    -v, --verbose        Output more detailed error information.\n"
         "                         Note that this option is not mutually exclusive with --quiet.\n"
         "    --version            Print out version number.\n"
+        "    --worker=<address>   Check the files handed out by the coordinator on the\n"
+        "                         given address (see --coordinator). The worker needs to\n"
+        "                         be given the same options as the coordinator (except the\n"
+        "                         files) and a local --cppcheck-build-dir. The source files\n"
+        "                         need to be accessible with the same paths.\n"
         "    --xml                Write results in xml format to error stream (stderr).\n"
         "\n"
         "Example usage:\n"
@@ -428,6 +428,17 @@ int CppCheckExecutor::check_internal(const Settings& settings, Suppressions& sup
     if (settings.reportProgress >= 0)
         stdLogger.resetLatestProgressOutputTime();
 
+#if defined(HAS_THREADING_MODEL_FORK)
+    if (!settings.worker.empty()) {
+        // the results are reported to the coordinator
+        ProcessExecutor executor(mFiles, mFileSettings, settings, supprs, stdLogger, timerResults.get(), CppCheckExecutor::executeCommand);
+        return executor.work();
+    }
+    const bool coordinator = !settings.coordinator.empty();
+#else
+    const bool coordinator = false;
+#endif
+
     if (settings.outputFormat == Settings::OutputFormat::xml) {
         stdLogger.reportErr(ErrorMessage::getXMLHeader(settings.cppcheckCfgProductName, settings.xml_version));
     }
@@ -447,19 +458,19 @@ int CppCheckExecutor::check_internal(const Settings& settings, Suppressions& sup
     CppCheck cppcheck(settings, supprs, stdLogger, timerResults.get(), true, executeCommand);
 
     unsigned int returnValue = 0;
-    if (settings.useSingleJob()) {
+    if (settings.useSingleJob() && !coordinator) {
         // Single process
         SingleExecutor executor(cppcheck, mFiles, mFileSettings, settings, supprs, stdLogger, timerResults.get());
         returnValue = executor.check();
     } else {
 #if defined(HAS_THREADING_MODEL_THREAD)
-        if (settings.executor == Settings::ExecutorType::Thread) {
+        if (settings.executor == Settings::ExecutorType::Thread && !coordinator) {
             ThreadExecutor executor(mFiles, mFileSettings, settings, supprs, stdLogger, timerResults.get(), CppCheckExecutor::executeCommand);
             returnValue = executor.check();
         }
 #endif
 #if defined(HAS_THREADING_MODEL_FORK)
-        if (settings.executor == Settings::ExecutorType::Process) {
+        if (coordinator || settings.executor == Settings::ExecutorType::Process || settings.executor == Settings::ExecutorType::ProcessPool) {
             ProcessExecutor executor(mFiles, mFileSettings, settings, supprs, stdLogger, timerResults.get(), CppCheckExecutor::executeCommand);
             returnValue = executor.check();
         }
@@ -21,15 +21,16 @@
 #include "color.h"
 #include "errorlogger.h"
 #include "errortypes.h"
+#include "filesettings.h"
 #include "settings.h"
 #include "suppressions.h"
+#include "utils.h"
 
+#include <algorithm>
 #include <cassert>
 #include <sstream>
 #include <utility>
 
-struct FileSettings;
-
 Executor::Executor(const std::list<FileWithDetails> &files, const std::list<FileSettings>& fileSettings, const Settings &settings, Suppressions &suppressions, ErrorLogger &errorLogger, TimerResults* timerResults)
     : mFiles(files), mFileSettings(fileSettings), mSettings(settings), mSuppressions(suppressions), mErrorLogger(errorLogger), mTimerResults(timerResults)
 {
@@ -73,3 +74,122 @@ void Executor::reportStatus(std::size_t fileindex, std::size_t filecount, std::s
     }
 }
 
+
+std::string Executor::getTimingKey(const Job &job)
+{
+    if (job.fs && job.fs->file.fsFileId() > 0)
+        return job.name + ' ' + std::to_string(job.fs->file.fsFileId());
+    return job.name;
+}
+
+std::vector<Executor::Job> Executor::getJobs()
+{
+    std::vector<Job> jobs;
+    jobs.reserve(mFiles.size() + mFileSettings.size());
+    for (const FileWithDetails &file : mFiles)
+        jobs.push_back({&file, nullptr, file.path(), file.size(), 0});
+    for (const FileSettings &fs : mFileSettings)
+        jobs.push_back({nullptr, &fs, fs.filename() + ' ' + fs.cfg, fs.file.size(), 0});
+
+    if (!mSettings.buildDir.empty()) {
+        std::lock_guard<std::mutex> lg(mTimingsSync);
+        mTimings = AnalyzerInformation::readTimingsTxt(mSettings.buildDir);
+        mPeakMemory = AnalyzerInformation::readPeakMemoryTxt(mSettings.buildDir);
+    }
+
+    mRecordedPeakMemory = 0;
+    mRecordedPeakMemorySize = 0;
+    for (const Job &job : jobs) {
+        const auto it = utils::as_const(mPeakMemory).find(getTimingKey(job));
+        if (it != mPeakMemory.cend() && job.size > 0) {
+            mRecordedPeakMemory += it->second;
+            mRecordedPeakMemorySize += job.size;
+        }
+    }
+
+    // estimate the time of the files without a recorded time based on the recorded time per size
+    std::size_t recordedTime = 0;
+    std::size_t recordedSize = 0;
+    std::vector<const std::size_t*> recorded(jobs.size(), nullptr);
+    for (std::size_t i = 0; i < jobs.size(); ++i) {
+        const auto it = utils::as_const(mTimings).find(getTimingKey(jobs[i]));
+        if (it == mTimings.cend())
+            continue;
+        recorded[i] = &it->second;
+        if (jobs[i].size > 0) {
+            recordedTime += it->second;
+            recordedSize += jobs[i].size;
+        }
+    }
+    for (std::size_t i = 0; i < jobs.size(); ++i) {
+        if (recorded[i])
+            jobs[i].cost = *recorded[i];
+        else if (recordedSize > 0)
+            jobs[i].cost = static_cast<std::size_t>(static_cast<double>(jobs[i].size) * recordedTime / recordedSize);
+        else
+            jobs[i].cost = jobs[i].size;
+    }
+
+    // keep the given order for jobs with the same cost
+    std::stable_sort(jobs.begin(), jobs.end(), [](const Job &j1, const Job &j2) {
+        return j1.cost > j2.cost;
+    });
+    return jobs;
+}
+
+void Executor::addTiming(const Job &job, std::chrono::milliseconds elapsed)
+{
+    if (mSettings.buildDir.empty())
+        return;
+
+    const auto time = static_cast<std::size_t>(elapsed.count());
+    std::lock_guard<std::mutex> lg(mTimingsSync);
+    const auto it = mTimings.emplace(getTimingKey(job), time);
+    // files which are not re-analyzed because of the cached results are much faster.
+    // only let these converge slowly so a file is still scheduled early when it gets
+    // modified again.
+    if (!it.second && time < it.first->second)
+        it.first->second = (it.first->second + time) / 2;
+    else
+        it.first->second = time;
+}
+
+void Executor::writeTimings()
+{
+    if (mSettings.buildDir.empty())
+        return;
+
+    std::lock_guard<std::mutex> lg(mTimingsSync);
+    AnalyzerInformation::writeTimingsTxt(mSettings.buildDir, mTimings);
+}
+
+std::size_t Executor::estimatePeakMemory(const Job &job) const
+{
+    const auto it = mPeakMemory.find(getTimingKey(job));
+    if (it != mPeakMemory.cend())
+        return it->second;
+    if (mRecordedPeakMemorySize == 0)
+        return 0;
+    return static_cast<std::size_t>(static_cast<double>(job.size) * mRecordedPeakMemory / mRecordedPeakMemorySize);
+}
+
+void Executor::addPeakMemory(const Job &job, std::size_t peakMemory)
+{
+    const auto it = mPeakMemory.emplace(getTimingKey(job), peakMemory);
+    if (job.size == 0)
+        return;
+    if (it.second)
+        mRecordedPeakMemorySize += job.size;
+    else
+        mRecordedPeakMemory -= it.first->second;
+    it.first->second = peakMemory;
+    mRecordedPeakMemory += peakMemory;
+}
+
+void Executor::writePeakMemory()
+{
+    if (mSettings.buildDir.empty())
+        return;
+
+    AnalyzerInformation::writePeakMemoryTxt(mSettings.buildDir, mPeakMemory);
+}
@@ -19,11 +19,15 @@
 #ifndef EXECUTOR_H
 #define EXECUTOR_H
 
+#include "analyzerinfo.h"
+
+#include <chrono>
 #include <cstddef>
 #include <list>
 #include <mutex>
 #include <string>
 #include <unordered_set>
+#include <vector>
 
 class Settings;
 class ErrorLogger;
@@ -50,6 +54,19 @@ public:
 
     virtual unsigned int check() = 0;
 
+    /** A single file to be analyzed - either file or fs is set */
+    struct Job
+    {
+        const FileWithDetails *file;
+        const FileSettings *fs;
+        /** name used for reporting */
+        std::string name;
+        /** size used for the status */
+        std::size_t size;
+        /** expected cost - the unit is only meaningful in relation to other jobs */
+        std::size_t cost;
+    };
+
     /**
      * Information about how many files have been checked
      *
@@ -61,6 +78,36 @@ public:
     void reportStatus(std::size_t fileindex, std::size_t filecount, std::size_t sizedone, std::size_t sizetotal);
 
 protected:
+    /**
+     * @brief Get the files to analyze ordered by their expected cost (most expensive first).
+     * This prevents the analysis from being held up by a single expensive file which
+     * happens to be scheduled last. The cost is based on the wall time recorded in the
+     * build dir by previous runs - the size is used for files without a recorded time.
+     */
+    std::vector<Job> getJobs();
+
+    /**
+     * @brief Record the wall time it took to analyze a file.
+     * Thread-safe.
+     */
+    void addTiming(const Job &job, std::chrono::milliseconds elapsed);
+
+    /** @brief Write the recorded timings into the build dir (if specified) */
+    void writeTimings();
+
+    /**
+     * @brief Estimate the peak memory usage (in KiB) of the process analyzing a file.
+     * Files without a recorded usage are estimated based on the recorded usage per size.
+     * @return 0 if there is nothing to base the estimate on
+     */
+    std::size_t estimatePeakMemory(const Job &job) const;
+
+    /** @brief Record the peak memory usage (in KiB) of the process which analyzed a file */
+    void addPeakMemory(const Job &job, std::size_t peakMemory);
+
+    /** @brief Write the recorded peak memory usages into the build dir (if specified) */
+    void writePeakMemory();
+
     /**
      * @brief Check if message is being suppressed and unique.
      * @param msg the message to check
@@ -76,6 +123,16 @@ protected:
     TimerResults *mTimerResults;
 
 private:
+    static std::string getTimingKey(const Job &job);
+
+    std::mutex mTimingsSync;
+    AnalyzerInformation::Timings mTimings;
+
+    AnalyzerInformation::PeakMemory mPeakMemory;
+    // the recorded peak memory usage and size of the files which are to be analyzed - used for the estimates
+    std::size_t mRecordedPeakMemory{};
+    std::size_t mRecordedPeakMemorySize{};
+
     std::mutex mErrorListSync;
     // TODO: store hashes instead of the full messages
     std::unordered_set<std::string> mErrorList;
@@ -24,10 +24,12 @@
 
 #ifdef HAS_THREADING_MODEL_FORK
 
+#include "analyzerinfo.h"
 #include "cppcheck.h"
 #include "errorlogger.h"
 #include "errortypes.h"
 #include "filesettings.h"
+#include "headercache.h"
 #include "settings.h"
 #include "suppressions.h"
 #include "timer.h"
@@ -42,16 +44,26 @@
 #include <cstdint>
 #include <cstdlib>
 #include <cstring>
+#include <fstream>
 #include <iostream>
 #include <list>
 #include <map>
 #include <memory>
 #include <sstream>
+#include <stdexcept>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/resource.h>
 #include <sys/select.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
 #include <sys/types.h>
+#include <sys/un.h>
 #include <sys/wait.h>
 #include <unistd.h>
 #include <utility>
+#include <vector>
 #include <fcntl.h>
 
 
@@ -73,13 +85,13 @@ ProcessExecutor::ProcessExecutor(const std::list<FileWithDetails> &files, const
     : Executor(files, fileSettings, settings, suppressions, errorLogger, timerResults)
     , mExecuteCommand(std::move(executeCommand))
 {
-    assert(mSettings.jobs > 1);
+    assert(mSettings.jobs > 1 || !mSettings.coordinator.empty() || !mSettings.worker.empty());
 }
 
 namespace {
     class PipeWriter : public ErrorLogger {
     public:
-        enum PipeSignal : std::uint8_t {REPORT_OUT='1',REPORT_ERROR='2',REPORT_SUPPR_INLINE='3',REPORT_SUPPR='4',CHILD_END='5',REPORT_METRIC='6',REPORT_TIMER='7'};
+        enum PipeSignal : std::uint8_t {REPORT_OUT='1',REPORT_ERROR='2',REPORT_SUPPR_INLINE='3',REPORT_SUPPR='4',CHILD_END='5',REPORT_METRIC='6',REPORT_TIMER='7',REPORT_PEAK_MEMORY='8',REPORT_ANALYZERINFO='9'};
 
         explicit PipeWriter(int pipe, bool debug) : mWpipe(pipe), mDebug(debug) {}
 
@@ -117,6 +129,14 @@ namespace {
             }
         }
 
+        void writePeakMemory(std::size_t peakMemory) const {
+            writeToPipe(REPORT_PEAK_MEMORY, std::to_string(peakMemory));
+        }
+
+        void writeAnalyzerInfo(const std::string &analyzerInfo) const {
+            writeToPipe(REPORT_ANALYZERINFO, analyzerInfo);
+        }
+
         void writeEnd(const std::string& str) const {
             writeToPipe(CHILD_END, str);
         }
@@ -177,8 +197,28 @@ namespace {
     };
 }
 
-bool ProcessExecutor::handleRead(int rpipe, unsigned int &result, const std::string& filename)
+namespace {
+    std::string getAnalyzerInfoFile(const std::string &buildDir, const Executor::Job &job)
+    {
+        const FileWithDetails &file = job.fs ? job.fs->file : *job.file;
+        return AnalyzerInformation::getAnalyzerInfoFile(buildDir, file.spath(), job.fs ? job.fs->cfg : "", file.fsFileId());
+    }
+
+    std::string readFile(const std::string &filename)
+    {
+        std::ifstream fin(filename, std::ios::binary);
+        if (!fin.is_open())
+            return "";
+        std::ostringstream oss;
+        oss << fin.rdbuf();
+        return oss.str();
+    }
+}
+
+ProcessExecutor::ReadResult ProcessExecutor::handleRead(int rpipe, unsigned int &result, const Job* job)
 {
+    const std::string filename = job ? job->name : std::string();
+
     std::size_t bytes_to_read;
     ssize_t bytes_read;
 
@@ -186,14 +226,12 @@ bool ProcessExecutor::handleRead(int rpipe, unsigned int &result, const std::str
     bytes_to_read = sizeof(char);
     bytes_read = read(rpipe, &type, bytes_to_read);
     if (bytes_read <= 0) {
-        if (errno == EAGAIN)
-            return true;
+        if (bytes_read < 0 && errno == EAGAIN)
+            return ReadResult::More;
 
         // TODO: log details about failure
 
-        // need to increment so a missing pipe (i.e. premature exit of forked process) results in an error exitcode
-        ++result;
-        return false;
+        return ReadResult::Closed;
     }
     if (bytes_read != bytes_to_read) {
         std::cerr << "#### ThreadExecutor::handleRead(" << filename << ") error (type): insufficient data read (expected: " << bytes_to_read << " / got: " << bytes_read << ")" << std::endl;
@@ -206,7 +244,9 @@ bool ProcessExecutor::handleRead(int rpipe, unsigned int &result, const std::str
         type != PipeWriter::REPORT_SUPPR &&
         type != PipeWriter::CHILD_END &&
         type != PipeWriter::REPORT_METRIC &&
-        type != PipeWriter::REPORT_TIMER) {
+        type != PipeWriter::REPORT_TIMER &&
+        type != PipeWriter::REPORT_PEAK_MEMORY &&
+        type != PipeWriter::REPORT_ANALYZERINFO) {
         std::cerr << "#### ThreadExecutor::handleRead(" << filename << ") invalid type " << int(type) << std::endl;
         std::exit(EXIT_FAILURE);
     }
@@ -243,7 +283,7 @@ bool ProcessExecutor::handleRead(int rpipe, unsigned int &result, const std::str
     if (mSettings.debugipc)
         std::cout << "handleRead - " << type << " - " << buf << std::endl;
 
-    bool res = true;
+    ReadResult res = ReadResult::More;
     if (type == PipeWriter::REPORT_OUT) {
         // the first character is the color
         const auto c = static_cast<Color>(buf[0]);
@@ -290,7 +330,7 @@ bool ProcessExecutor::handleRead(int rpipe, unsigned int &result, const std::str
         }
     } else if (type == PipeWriter::CHILD_END) {
         result += std::stoi(buf);
-        res = false;
+        res = ReadResult::Done;
     } else if (type == PipeWriter::REPORT_METRIC) {
         mErrorLogger.reportMetric(buf);
     } else if (type == PipeWriter::REPORT_TIMER) {
@@ -307,11 +347,31 @@ bool ProcessExecutor::handleRead(int rpipe, unsigned int &result, const std::str
             std::exit(EXIT_FAILURE);
         }
         mTimerResults->addResults(parts[0], std::chrono::milliseconds{strToInt<long>(parts[1])});
+    } else if (type == PipeWriter::REPORT_PEAK_MEMORY) {
+        if (job)
+            addPeakMemory(*job, strToInt<std::size_t>(buf));
+    } else if (type == PipeWriter::REPORT_ANALYZERINFO) {
+        // the analyzer information of a worker is used for the whole program analysis
+        if (job) {
+            std::ofstream fout(getAnalyzerInfoFile(mSettings.buildDir, *job), std::ios::binary);
+            fout << buf;
+        }
     }
 
     return res;
 }
 
+std::list<const Executor::Job*>::iterator ProcessExecutor::nextJob(std::list<const Job*> &pending, std::size_t runningMemory, std::size_t running) const
+{
+    if (mSettings.maxMemory == 0 || running == 0)
+        return pending.begin();
+
+    const std::size_t maxMemory = static_cast<std::size_t>(mSettings.maxMemory) * 1024;
+    return std::find_if(pending.begin(), pending.end(), [&](const Job *job) {
+        return runningMemory + estimatePeakMemory(*job) <= maxMemory;
+    });
+}
+
 bool ProcessExecutor::checkLoadAverage(size_t nchildren)
 {
 #if defined(__QNX__) || defined(__HAIKU__) || defined(_AIX) // getloadavg() is unsupported on Qnx, Haiku, AIX.
@@ -334,15 +394,401 @@ bool ProcessExecutor::checkLoadAverage(size_t nchildren)
 #endif
 }
 
+namespace {
+    void createPipe(int (&pipes)[2])
+    {
+        if (pipe(pipes) == -1) {
+            std::cerr << "#### ThreadExecutor::check, pipe() failed: "<< std::strerror(errno) << std::endl;
+            std::exit(EXIT_FAILURE);
+        }
+
+        const int flags = fcntl(pipes[0], F_GETFL, 0);
+        if (flags < 0) {
+            std::cerr << "#### ThreadExecutor::check, fcntl(F_GETFL) failed: "<< std::strerror(errno) << std::endl;
+            std::exit(EXIT_FAILURE);
+        }
+
+        if (fcntl(pipes[0], F_SETFL, flags) < 0) {
+            std::cerr << "#### ThreadExecutor::check, fcntl(F_SETFL) failed: "<< std::strerror(errno) << std::endl;
+            std::exit(EXIT_FAILURE);
+        }
+    }
+
+    /** reset the peak memory usage of the current process (if supported) */
+    void resetPeakMemory()
+    {
+#if defined(__linux__)
+        // resets VmHWM to the current memory usage - if this is not permitted the peak of the process lifetime is reported
+        std::ofstream fout("/proc/self/clear_refs");
+        fout << "5";
+#endif
+    }
+
+    /** @return the peak memory usage (in KiB) of the current process */
+    std::size_t getPeakMemory()
+    {
+#if defined(__linux__)
+        std::ifstream fin("/proc/self/status");
+        std::string line;
+        while (std::getline(fin, line)) {
+            if (line.compare(0, 6, "VmHWM:") == 0)
+                return std::strtoul(line.c_str() + 6, nullptr, 10);
+        }
+#endif
+        rusage usage{};
+        if (getrusage(RUSAGE_SELF, &usage) != 0)
+            return 0;
+#if defined(__APPLE__)
+        // reported in bytes
+        return usage.ru_maxrss / 1024;
+#else
+        return usage.ru_maxrss;
+#endif
+    }
+
+    /** A long-lived child process of the process pool */
+    struct PoolWorker
+    {
+        pid_t pid;
+        /** the indexes of the jobs to check are written to this */
+        int cmdPipe;
+        /** the results are read from this */
+        int resultPipe;
+        /** the job which is currently checked */
+        const Executor::Job *job;
+        std::chrono::steady_clock::time_point start;
+        /** the estimated peak memory usage (in KiB) of the job */
+        std::size_t peakMemory;
+    };
+
+    /** A child process of the per-file mode */
+    struct RunningJob
+    {
+        const Executor::Job *job;
+        std::chrono::steady_clock::time_point start;
+        /** the estimated peak memory usage (in KiB) of the job */
+        std::size_t peakMemory;
+    };
+
+    // the jobs are sent as fixed size binary frames
+    using JobIndex = std::uint32_t;
+
+    bool writeJobIndex(int wpipe, JobIndex index)
+    {
+        return write(wpipe, &index, sizeof(index)) == sizeof(index);
+    }
+
+    bool readAll(int rpipe, char *data, std::size_t bytes_to_read)
+    {
+        while (bytes_to_read > 0) {
+            const ssize_t bytes_read = read(rpipe, data, bytes_to_read);
+            if (bytes_read <= 0) {
+                if (bytes_read < 0 && errno == EINTR)
+                    continue;
+                return false;
+            }
+            bytes_to_read -= bytes_read;
+            data += bytes_read;
+        }
+        return true;
+    }
+
+    bool readJobIndex(int rpipe, JobIndex &index)
+    {
+        return readAll(rpipe, reinterpret_cast<char*>(&index), sizeof(index));
+    }
+
+    bool writeAll(int wpipe, const char *data, std::size_t bytes_to_write)
+    {
+        while (bytes_to_write > 0) {
+            const ssize_t bytes_written = write(wpipe, data, bytes_to_write);
+            if (bytes_written <= 0) {
+                if (bytes_written < 0 && errno == EINTR)
+                    continue;
+                return false;
+            }
+            bytes_to_write -= bytes_written;
+            data += bytes_written;
+        }
+        return true;
+    }
+
+    /** A worker connected to the coordinator */
+    struct RemoteWorker
+    {
+        int fd;
+        /** the job which is currently checked */
+        const Executor::Job *job;
+        std::chrono::steady_clock::time_point start;
+    };
+
+    // the frames sent from the coordinator to the workers - they use the same layout as the ones of the PipeWriter
+    enum CoordinatorSignal : std::uint8_t {SEND_JOB='J',SEND_ANALYZERINFO='A'};
+
+    bool writeFrame(int fd, char type, const std::string &data)
+    {
+        const auto len = static_cast<unsigned int>(data.length());
+        return writeAll(fd, &type, 1) &&
+               writeAll(fd, reinterpret_cast<const char*>(&len), sizeof(len)) &&
+               writeAll(fd, data.data(), len);
+    }
+
+    bool readFrame(int fd, char &type, std::string &data)
+    {
+        unsigned int len = 0;
+        if (!readAll(fd, &type, 1) || !readAll(fd, reinterpret_cast<char*>(&len), sizeof(len)))
+            return false;
+        data.resize(len);
+        return len == 0 || readAll(fd, &data[0], len);
+    }
+
+    template<class T>
+    void serializeList(std::ostream &os, const T &list)
+    {
+        os << list.size() << '\n';
+        for (const std::string &entry : list)
+            os << entry << '\n';
+    }
+
+    // one value per line - lists are prefixed with their size
+    std::string serializeJob(const Executor::Job &job)
+    {
+        const FileWithDetails &file = job.fs ? job.fs->file : *job.file;
+        std::ostringstream oss;
+        oss << (job.fs ? 's' : 'f') << '\n'
+            << file.path() << '\n'
+            << static_cast<int>(file.lang()) << '\n'
+            << file.size() << '\n'
+            << file.fsFileId() << '\n';
+        if (job.fs) {
+            const FileSettings &fs = *job.fs;
+            oss << fs.cfg << '\n'
+                << fs.defines << '\n';
+            serializeList(oss, fs.undefs);
+            serializeList(oss, fs.includePaths);
+            serializeList(oss, fs.forcedIncludes);
+            serializeList(oss, fs.systemIncludePaths);
+            oss << fs.standard << '\n'
+                << static_cast<int>(fs.platformType) << '\n'
+                << fs.msc << '\n'
+                << fs.useMfc << '\n'
+                << fs.timeBitsDefined << '\n'
+                << fs.timeBitsValue << '\n'
+                << fs.useTimeBits64Defined << '\n'
+                << fs.fileOffsetBitsDefined << '\n'
+                << fs.fileOffsetBitsValue << '\n';
+        }
+        return oss.str();
+    }
+
+    /** A job received from the coordinator - either file or fs is set */
+    struct ReceivedJob
+    {
+        std::unique_ptr<FileWithDetails> file;
+        std::unique_ptr<FileSettings> fs;
+    };
+
+    bool deserializeJob(const std::string &data, ReceivedJob &job)
+    {
+        std::istringstream iss(data);
+        const auto next = [&iss]() {
+            std::string line;
+            if (!std::getline(iss, line))
+                throw std::runtime_error("insufficient data");
+            return line;
+        };
+        const auto nextList = [&next]() {
+            std::list<std::string> list;
+            for (auto n = strToInt<std::size_t>(next()); n > 0; --n)
+                list.push_back(next());
+            return list;
+        };
+
+        try {
+            const std::string kind = next();
+            std::string path = next();
+            const auto lang = static_cast<Standards::Language>(strToInt<int>(next()));
+            const auto size = strToInt<std::size_t>(next());
+            const auto fsFileId = strToInt<std::size_t>(next());
+            if (kind == "f") {
+                job.file.reset(new FileWithDetails(std::move(path), lang, size));
+                job.file->setFsFileId(fsFileId);
+                return true;
+            }
+            if (kind != "s")
+                return false;
+            job.fs.reset(new FileSettings(std::move(path), lang, size));
+            FileSettings &fs = *job.fs;
+            fs.file.setFsFileId(fsFileId);
+            fs.cfg = next();
+            fs.defines = next();
+            const std::list<std::string> undefs = nextList();
+            fs.undefs.insert(undefs.cbegin(), undefs.cend());
+            fs.includePaths = nextList();
+            fs.forcedIncludes = nextList();
+            fs.systemIncludePaths = nextList();
+            fs.standard = next();
+            fs.platformType = static_cast<Platform::Type>(strToInt<int>(next()));
+            fs.msc = next() == "1";
+            fs.useMfc = next() == "1";
+            fs.timeBitsDefined = next() == "1";
+            fs.timeBitsValue = strToInt<int>(next());
+            fs.useTimeBits64Defined = next() == "1";
+            fs.fileOffsetBitsDefined = next() == "1";
+            fs.fileOffsetBitsValue = strToInt<int>(next());
+        } catch (const std::runtime_error&) {
+            return false;
+        }
+        return true;
+    }
+
+    /**
+     * @brief Open a socket listening on or connected to the given address
+     * @param address either 'unix:<path>' or '<host>:<port>'
+     * @param listening listen on the address instead of connecting to it
+     * @param err the error if the socket could not be opened
+     * @return the socket or -1 on error
+     */
+    int openSocket(const std::string &address, bool listening, std::string &err)
+    {
+        int fd = -1;
+        if (startsWith(address, "unix:")) {
+            const std::string path = address.substr(5);
+            sockaddr_un addr{};
+            if (path.empty() || path.size() >= sizeof(addr.sun_path)) {
+                err = "invalid socket path";
+                return -1;
+            }
+            addr.sun_family = AF_UNIX;
+            std::memcpy(addr.sun_path, path.c_str(), path.size() + 1);
+
+            fd = socket(AF_UNIX, SOCK_STREAM, 0);
+            if (fd == -1) {
+                err = std::strerror(errno);
+                return -1;
+            }
+            if (listening) {
+                // remove the socket of a previous run
+                struct stat st{};
+                if (stat(path.c_str(), &st) == 0 && S_ISSOCK(st.st_mode))
+                    unlink(path.c_str());
+            }
+            const auto *sa = reinterpret_cast<const sockaddr*>(&addr);
+            if ((listening ? bind(fd, sa, sizeof(addr)) : connect(fd, sa, sizeof(addr))) == -1 ||
+                (listening && listen(fd, SOMAXCONN) == -1)) {
+                err = std::strerror(errno);
+                close(fd);
+                return -1;
+            }
+        }
+        else {
+            const std::string::size_type pos = address.rfind(':');
+            if (pos == std::string::npos) {
+                err = "no port specified";
+                return -1;
+            }
+            std::string host = address.substr(0, pos);
+            const std::string port = address.substr(pos + 1);
+            // IPv6 address
+            if (host.size() >= 2 && host.front() == '[' && host.back() == ']')
+                host = host.substr(1, host.size() - 2);
+
+            addrinfo hints{};
+            hints.ai_family = AF_UNSPEC;
+            hints.ai_socktype = SOCK_STREAM;
+            if (listening)
+                hints.ai_flags = AI_PASSIVE;
+            addrinfo *res = nullptr;
+            const int gaiErr = getaddrinfo(host.empty() ? nullptr : host.c_str(), port.c_str(), &hints, &res);
+            if (gaiErr != 0) {
+                err = gai_strerror(gaiErr);
+                return -1;
+            }
+            err = "no address found";
+            for (const addrinfo *ai = res; ai; ai = ai->ai_next) {
+                fd = socket(ai->ai_family, ai->ai_socktype, ai->ai_protocol);
+                if (fd == -1) {
+                    err = std::strerror(errno);
+                    continue;
+                }
+                const int one = 1;
+                if (listening)
+                    setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+                if ((listening ? bind(fd, ai->ai_addr, ai->ai_addrlen) : connect(fd, ai->ai_addr, ai->ai_addrlen)) == 0 &&
+                    (!listening || listen(fd, SOMAXCONN) == 0)) {
+                    // the messages are small and need to be delivered immediately
+                    if (!listening)
+                        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+                    break;
+                }
+                err = std::strerror(errno);
+                close(fd);
+                fd = -1;
+            }
+            freeaddrinfo(res);
+            if (fd == -1)
+                return -1;
+        }
+        // do not leak the socket into the executed addons and tools
+        fcntl(fd, F_SETFD, FD_CLOEXEC);
+        return fd;
+    }
+}
+
+void ProcessExecutor::checkJob(const Job &job, Suppressions &supprs, int wpipe) const
+{
+    // create a separate result object so we do not get the results which have already been transferred back
+    std::unique_ptr<TimerResults> timerResults;
+    if (mTimerResults)
+        timerResults.reset(new TimerResults);
+
+    // the peak memory is only needed to estimate the memory usage of the files
+    const bool recordPeakMemory = !mSettings.buildDir.empty() || mSettings.maxMemory > 0;
+    if (recordPeakMemory)
+        resetPeakMemory();
+
+    PipeWriter pipewriter(wpipe, mSettings.debugipc);
+    CppCheck fileChecker(mSettings, supprs, pipewriter, timerResults.get(), false, mExecuteCommand);
+    unsigned int resultOfCheck = 0;
+
+    if (job.fs) {
+        resultOfCheck = fileChecker.check(*job.fs);
+    } else {
+        // Read file from a file
+        resultOfCheck = fileChecker.check(*job.file);
+    }
+
+    pipewriter.writeSuppr(supprs.nomsg);
+
+    pipewriter.writeTimer(timerResults.get());
+
+    if (recordPeakMemory)
+        pipewriter.writePeakMemory(getPeakMemory());
+
+    // the coordinator performs the whole program analysis
+    if (!mSettings.worker.empty())
+        pipewriter.writeAnalyzerInfo(readFile(getAnalyzerInfoFile(mSettings.buildDir, job)));
+
+    pipewriter.writeEnd(std::to_string(resultOfCheck));
+}
+
 unsigned int ProcessExecutor::check()
 {
+    if (!mSettings.coordinator.empty())
+        return checkCoordinator();
+    if (mSettings.executor == Settings::ExecutorType::ProcessPool)
+        return checkPool();
+
     unsigned int fileCount = 0;
     unsigned int result = 0;
 
-    const std::size_t totalfilesize = std::accumulate(mFiles.cbegin(), mFiles.cend(), std::size_t(0), [](std::size_t v, const FileWithDetails& p) {
-        return v + p.size();
+    const std::vector<Job> jobs = getJobs();
+    const std::size_t totalfilesize = std::accumulate(jobs.cbegin(), jobs.cend(), std::size_t(0), [](std::size_t v, const Job& job) {
+        return job.file ? v + job.size : v;
     });
 
+    prewarmHeaderCache(jobs);
+
     // pass unmodified suppressions to forked process so we only transfer back the actual changes done by the fork
     // and do not see the changes which have already been transferred back
     Suppressions supprs;
@@ -351,30 +797,24 @@ unsigned int ProcessExecutor::check()
 
     std::list<int> rpipes;
     std::map<pid_t, std::string> childFile;
-    std::map<int, std::string> pipeFile;
+    std::map<int, RunningJob> pipeFile;
     std::size_t processedsize = 0;
-    auto iFile = mFiles.cbegin();
-    auto iFileSettings = mFileSettings.cbegin();
+    std::list<const Job*> pending;
+    for (const Job &job : jobs)
+        pending.push_back(&job);
+    std::size_t runningMemory = 0;
     for (;;) {
         // Start a new child
         const size_t nchildren = childFile.size();
-        if ((iFile != mFiles.cend() || iFileSettings != mFileSettings.cend()) && nchildren < mSettings.jobs && checkLoadAverage(nchildren)) {
-            int pipes[2];
-            if (pipe(pipes) == -1) {
-                std::cerr << "#### ThreadExecutor::check, pipe() failed: "<< std::strerror(errno) << std::endl;
-                std::exit(EXIT_FAILURE);
-            }
+        auto next = pending.end();
+        if (!pending.empty() && nchildren < mSettings.jobs && checkLoadAverage(nchildren))
+            next = nextJob(pending, runningMemory, pipeFile.size());
+        if (next != pending.end()) {
+            const Job &job = **next;
+            pending.erase(next);
 
-            const int flags = fcntl(pipes[0], F_GETFL, 0);
-            if (flags < 0) {
-                std::cerr << "#### ThreadExecutor::check, fcntl(F_GETFL) failed: "<< std::strerror(errno) << std::endl;
-                std::exit(EXIT_FAILURE);
-            }
-
-            if (fcntl(pipes[0], F_SETFL, flags) < 0) {
-                std::cerr << "#### ThreadExecutor::check, fcntl(F_SETFL) failed: "<< std::strerror(errno) << std::endl;
-                std::exit(EXIT_FAILURE);
-            }
+            int pipes[2];
+            createPipe(pipes);
 
             const pid_t pid = fork();
             if (pid < 0) {
@@ -387,41 +827,16 @@ unsigned int ProcessExecutor::check()
 #endif
                 close(pipes[0]);
 
-                // create a separate result object so we do not get the results which have already been transferred back
-                std::unique_ptr<TimerResults> timerResults;
-                if (mTimerResults)
-                    timerResults.reset(new TimerResults);
-
-                PipeWriter pipewriter(pipes[1], mSettings.debugipc);
-                CppCheck fileChecker(mSettings, supprs, pipewriter, timerResults.get(), false, mExecuteCommand);
-                unsigned int resultOfCheck = 0;
-
-                if (iFileSettings != mFileSettings.end()) {
-                    resultOfCheck = fileChecker.check(*iFileSettings);
-                } else {
-                    // Read file from a file
-                    resultOfCheck = fileChecker.check(*iFile);
-                }
-
-                pipewriter.writeSuppr(supprs.nomsg);
-
-                pipewriter.writeTimer(timerResults.get());
-
-                pipewriter.writeEnd(std::to_string(resultOfCheck));
+                checkJob(job, supprs, pipes[1]);
                 std::exit(EXIT_SUCCESS);
             }
 
             close(pipes[1]);
             rpipes.push_back(pipes[0]);
-            if (iFileSettings != mFileSettings.end()) {
-                childFile[pid] = iFileSettings->filename() + ' ' + iFileSettings->cfg;
-                pipeFile[pipes[0]] = iFileSettings->filename() + ' ' + iFileSettings->cfg;
-                ++iFileSettings;
-            } else {
-                childFile[pid] = iFile->path();
-                pipeFile[pipes[0]] = iFile->path();
-                ++iFile;
-            }
+            childFile[pid] = job.name;
+            const std::size_t peakMemory = estimatePeakMemory(job);
+            pipeFile[pipes[0]] = {&job, std::chrono::steady_clock::now(), peakMemory};
+            runningMemory += peakMemory;
         }
         if (!rpipes.empty()) {
             fd_set rfds;
@@ -437,22 +852,20 @@ unsigned int ProcessExecutor::check()
                 auto rp = rpipes.cbegin();
                 while (rp != rpipes.cend()) {
                     if (FD_ISSET(*rp, &rfds)) {
-                        std::string name;
                         const auto p = utils::as_const(pipeFile).find(*rp);
-                        if (p != pipeFile.cend()) {
-                            name = p->second;
-                        }
-                        const bool readRes = handleRead(*rp, result, name);
-                        if (!readRes) {
+                        const ReadResult readRes = handleRead(*rp, result, p != pipeFile.cend() ? p->second.job : nullptr);
+                        // need to increment so a missing pipe (i.e. premature exit of forked process) results in an error exitcode
+                        if (readRes == ReadResult::Closed)
+                            ++result;
+                        if (readRes != ReadResult::More) {
                             std::size_t size = 0;
                             if (p != pipeFile.cend()) {
+                                const Job &job = *p->second.job;
+                                if (job.file)
+                                    size = job.size;
+                                addTiming(job, std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - p->second.start));
+                                runningMemory -= p->second.peakMemory;
                                 pipeFile.erase(p);
-                                const auto fs = std::find_if(mFiles.cbegin(), mFiles.cend(), [&name](const FileWithDetails& entry) {
-                                    return entry.path() == name;
-                                });
-                                if (fs != mFiles.end()) {
-                                    size = fs->size();
-                                }
                             }
 
                             fileCount++;
@@ -494,7 +907,7 @@ unsigned int ProcessExecutor::check()
                 }
             }
         }
-        if (iFile == mFiles.end() && iFileSettings == mFileSettings.end() && rpipes.empty() && childFile.empty()) {
+        if (pending.empty() && rpipes.empty() && childFile.empty()) {
             // All done
             break;
         }
@@ -502,9 +915,426 @@ unsigned int ProcessExecutor::check()
 
     // TODO: we need to get the timing information from the subprocess
 
+    writeTimings();
+    writePeakMemory();
+
+    return result;
+}
+
+void ProcessExecutor::prewarmHeaderCache(const std::vector<Job> &jobs) const
+{
+    // the includes of a single file are lexed up front - most of them are usually shared by all files
+    if (mSettings.clang || mSettings.jobs <= 1 || jobs.size() <= 1)
+        return;
+    const Job &job = jobs.front();
+    if (job.file) {
+        HeaderCache::instance().prewarm(job.file->path(), mSettings.includePaths, mSettings.userIncludes);
+    } else {
+        std::list<std::string> includes = mSettings.userIncludes;
+        includes.insert(includes.end(), job.fs->forcedIncludes.cbegin(), job.fs->forcedIncludes.cend());
+        HeaderCache::instance().prewarm(job.fs->filename(), job.fs->includePaths, includes);
+    }
+}
+
+unsigned int ProcessExecutor::checkPool()
+{
+    unsigned int fileCount = 0;
+    unsigned int result = 0;
+
+    const std::vector<Job> jobs = getJobs();
+    const std::size_t totalfilesize = std::accumulate(jobs.cbegin(), jobs.cend(), std::size_t(0), [](std::size_t v, const Job& job) {
+        return job.file ? v + job.size : v;
+    });
+
+    prewarmHeaderCache(jobs);
+
+    // unmodified suppressions which are copied for every job so we only transfer back the actual changes done
+    // by the job and not the ones of the jobs previously checked by the same worker
+    Suppressions supprs;
+    supprs.nomsg.addSuppressions(mSuppressions.nomsg.getSuppressions());
+    supprs.nofail.addSuppressions(mSuppressions.nofail.getSuppressions());
+
+    // a worker might have crashed before a job is sent to it - do not terminate
+    struct sigaction ignorePipe = {};
+    ignorePipe.sa_handler = SIG_IGN;
+    struct sigaction oldPipe = {};
+    sigaction(SIGPIPE, &ignorePipe, &oldPipe);
+
+    std::list<PoolWorker> workers;
+    std::map<pid_t, std::string> childFile;
+    std::size_t processedsize = 0;
+    std::list<const Job*> pending;
+    for (const Job &job : jobs)
+        pending.push_back(&job);
+    std::size_t runningMemory = 0;
+    for (;;) {
+        const std::size_t busy = std::count_if(workers.cbegin(), workers.cend(), [](const PoolWorker& w) {
+            return w.job != nullptr;
+        });
+
+        // Start a new worker - this also replaces the ones which exited prematurely
+        const std::size_t remaining = pending.size();
+        if (workers.size() < mSettings.jobs && workers.size() < busy + remaining) {
+            int cmdPipes[2];
+            createPipe(cmdPipes);
+            int resultPipes[2];
+            createPipe(resultPipes);
+
+            const pid_t pid = fork();
+            if (pid < 0) {
+                // Error
+                std::cerr << "#### ThreadExecutor::check, Failed to create child process: "<< std::strerror(errno) << std::endl;
+                std::exit(EXIT_FAILURE);
+            } else if (pid == 0) {
+#if defined(__linux__)
+                prctl(PR_SET_PDEATHSIG, SIGHUP);
+#endif
+                sigaction(SIGPIPE, &oldPipe, nullptr);
+
+                // the worker must not keep the pipes of the other workers open
+                for (const PoolWorker &w : workers) {
+                    if (w.cmdPipe != -1)
+                        close(w.cmdPipe);
+                    close(w.resultPipe);
+                }
+                close(cmdPipes[1]);
+                close(resultPipes[0]);
+
+                JobIndex index = 0;
+                while (readJobIndex(cmdPipes[0], index)) {
+                    Suppressions jobSupprs;
+                    jobSupprs.nomsg.addSuppressions(supprs.nomsg.getSuppressions());
+                    jobSupprs.nofail.addSuppressions(supprs.nofail.getSuppressions());
+                    checkJob(jobs[index], jobSupprs, resultPipes[1]);
+                }
+                std::exit(EXIT_SUCCESS);
+            }
+
+            close(cmdPipes[0]);
+            close(resultPipes[1]);
+            workers.push_back({pid, cmdPipes[1], resultPipes[0], nullptr, {}, 0});
+            childFile[pid] = "";
+            continue;
+        }
+
+        // Hand out the jobs to the idle workers
+        for (auto w = workers.begin(); w != workers.end();) {
+            if (w->job || w->cmdPipe == -1) {
+                ++w;
+                continue;
+            }
+            if (pending.empty()) {
+                // nothing left to do - the worker exits when its command pipe is closed
+                close(w->cmdPipe);
+                w->cmdPipe = -1;
+                ++w;
+                continue;
+            }
+            const std::size_t nbusy = std::count_if(workers.cbegin(), workers.cend(), [](const PoolWorker& worker) {
+                return worker.job != nullptr;
+            });
+            if (!checkLoadAverage(nbusy))
+                break;
+            const auto next = nextJob(pending, runningMemory, nbusy);
+            if (next == pending.end())
+                break;
+            const Job &job = **next;
+            if (!writeJobIndex(w->cmdPipe, static_cast<JobIndex>(&job - jobs.data()))) {
+                // the worker has already exited - it will be replaced
+                close(w->cmdPipe);
+                close(w->resultPipe);
+                w = workers.erase(w);
+                continue;
+            }
+            pending.erase(next);
+            w->job = &job;
+            w->start = std::chrono::steady_clock::now();
+            w->peakMemory = estimatePeakMemory(job);
+            runningMemory += w->peakMemory;
+            childFile[w->pid] = job.name;
+            ++w;
+        }
+
+        if (!workers.empty()) {
+            fd_set rfds;
+            FD_ZERO(&rfds);
+            int maxfd = -1;
+            for (const PoolWorker &w : workers) {
+                FD_SET(w.resultPipe, &rfds);
+                maxfd = std::max(maxfd, w.resultPipe);
+            }
+            timeval tv; // for every second polling of load average condition
+            tv.tv_sec = 1;
+            tv.tv_usec = 0;
+            const int r = select(maxfd + 1, &rfds, nullptr, nullptr, &tv);
+
+            if (r > 0) {
+                auto w = workers.begin();
+                while (w != workers.end()) {
+                    if (!FD_ISSET(w->resultPipe, &rfds)) {
+                        ++w;
+                        continue;
+                    }
+                    const ReadResult readRes = handleRead(w->resultPipe, result, w->job);
+                    if (readRes == ReadResult::More) {
+                        ++w;
+                        continue;
+                    }
+                    if (w->job) {
+                        // need to increment so a premature exit of the worker results in an error exitcode
+                        if (readRes == ReadResult::Closed)
+                            ++result;
+                        else {
+                            addTiming(*w->job, std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - w->start));
+                            const auto c = childFile.find(w->pid);
+                            if (c != childFile.end())
+                                c->second.clear();
+                        }
+
+                        fileCount++;
+                        if (w->job->file)
+                            processedsize += w->job->size;
+                        if (!mSettings.quiet)
+                            Executor::reportStatus(fileCount, mFiles.size() + mFileSettings.size(), processedsize, totalfilesize);
+
+                        runningMemory -= w->peakMemory;
+                        w->job = nullptr;
+                    }
+                    if (readRes == ReadResult::Closed) {
+                        if (w->cmdPipe != -1)
+                            close(w->cmdPipe);
+                        close(w->resultPipe);
+                        w = workers.erase(w);
+                    } else
+                        ++w;
+                }
+            }
+        }
+        if (!childFile.empty()) {
+            int stat = 0;
+            const pid_t child = waitpid(0, &stat, WNOHANG);
+            if (child > 0) {
+                std::string childname;
+                const auto c = utils::as_const(childFile).find(child);
+                if (c != childFile.cend()) {
+                    childname = c->second;
+                    childFile.erase(c);
+                }
+
+                if (WIFEXITED(stat)) {
+                    const int exitstatus = WEXITSTATUS(stat);
+                    if (exitstatus != EXIT_SUCCESS) {
+                        std::ostringstream oss;
+                        oss << "Child process exited with " << exitstatus;
+                        reportInternalChildErr(childname, oss.str());
+                    }
+                } else if (WIFSIGNALED(stat)) {
+                    std::ostringstream oss;
+                    oss << "Child process crashed with signal " << WTERMSIG(stat);
+                    reportInternalChildErr(childname, oss.str());
+                }
+            }
+        }
+        if (pending.empty() && workers.empty() && childFile.empty()) {
+            // All done
+            break;
+        }
+    }
+
+    sigaction(SIGPIPE, &oldPipe, nullptr);
+
+    writeTimings();
+    writePeakMemory();
+
     return result;
 }
 
+unsigned int ProcessExecutor::checkCoordinator()
+{
+    unsigned int fileCount = 0;
+    unsigned int result = 0;
+
+    const std::vector<Job> jobs = getJobs();
+    const std::size_t totalfilesize = std::accumulate(jobs.cbegin(), jobs.cend(), std::size_t(0), [](std::size_t v, const Job& job) {
+        return job.file ? v + job.size : v;
+    });
+
+    std::string err;
+    const int listenfd = openSocket(mSettings.coordinator, true, err);
+    if (listenfd == -1) {
+        std::cerr << "#### ProcessExecutor::checkCoordinator, failed to listen on '" << mSettings.coordinator << "': " << err << std::endl;
+        std::exit(EXIT_FAILURE);
+    }
+
+    // a worker might have disconnected before a job is sent to it - do not terminate
+    struct sigaction ignorePipe = {};
+    ignorePipe.sa_handler = SIG_IGN;
+    struct sigaction oldPipe = {};
+    sigaction(SIGPIPE, &ignorePipe, &oldPipe);
+
+    std::list<RemoteWorker> workers;
+    std::list<const Job*> pending;
+    for (const Job &job : jobs)
+        pending.push_back(&job);
+    std::size_t processedsize = 0;
+    for (;;) {
+        // Hand out the jobs to the idle workers along with the analyzer information of previous runs
+        for (auto w = workers.begin(); w != workers.end() && !pending.empty();) {
+            if (w->job) {
+                ++w;
+                continue;
+            }
+            const Job &job = *pending.front();
+            if (!writeFrame(w->fd, SEND_JOB, serializeJob(job)) ||
+                !writeFrame(w->fd, SEND_ANALYZERINFO, readFile(getAnalyzerInfoFile(mSettings.buildDir, job)))) {
+                // the worker has disconnected
+                close(w->fd);
+                w = workers.erase(w);
+                continue;
+            }
+            pending.pop_front();
+            w->job = &job;
+            w->start = std::chrono::steady_clock::now();
+            ++w;
+        }
+
+        const bool busy = std::any_of(workers.cbegin(), workers.cend(), [](const RemoteWorker& w) {
+            return w.job != nullptr;
+        });
+        if (pending.empty() && !busy) {
+            // All done
+            break;
+        }
+
+        fd_set rfds;
+        FD_ZERO(&rfds);
+        FD_SET(listenfd, &rfds);
+        int maxfd = listenfd;
+        for (const RemoteWorker &w : workers) {
+            FD_SET(w.fd, &rfds);
+            maxfd = std::max(maxfd, w.fd);
+        }
+        timeval tv;
+        tv.tv_sec = 1;
+        tv.tv_usec = 0;
+        const int r = select(maxfd + 1, &rfds, nullptr, nullptr, &tv);
+        if (r <= 0)
+            continue;
+
+        if (FD_ISSET(listenfd, &rfds)) {
+            const int fd = accept(listenfd, nullptr, nullptr);
+            if (fd != -1) {
+                const int one = 1;
+                setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one)); // fails for Unix sockets
+                workers.push_back({fd, nullptr, {}});
+            }
+        }
+
+        auto w = workers.begin();
+        while (w != workers.end()) {
+            if (!FD_ISSET(w->fd, &rfds)) {
+                ++w;
+                continue;
+            }
+            const ReadResult readRes = handleRead(w->fd, result, w->job);
+            if (readRes == ReadResult::More) {
+                ++w;
+                continue;
+            }
+            if (w->job) {
+                if (readRes == ReadResult::Closed) {
+                    // need to increment so a premature disconnect of the worker results in an error exitcode
+                    ++result;
+                    reportInternalChildErr(w->job->name, "Worker disconnected");
+                }
+                else
+                    addTiming(*w->job, std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - w->start));
+
+                fileCount++;
+                if (w->job->file)
+                    processedsize += w->job->size;
+                if (!mSettings.quiet)
+                    Executor::reportStatus(fileCount, mFiles.size() + mFileSettings.size(), processedsize, totalfilesize);
+
+                w->job = nullptr;
+            }
+            if (readRes == ReadResult::Closed) {
+                close(w->fd);
+                w = workers.erase(w);
+            } else
+                ++w;
+        }
+    }
+
+    // the workers exit when the connection is closed
+    for (const RemoteWorker &w : workers)
+        close(w.fd);
+    close(listenfd);
+    if (startsWith(mSettings.coordinator, "unix:"))
+        unlink(mSettings.coordinator.c_str() + 5);
+
+    sigaction(SIGPIPE, &oldPipe, nullptr);
+
+    writeTimings();
+
+    return result;
+}
+
+int ProcessExecutor::work()
+{
+    // the worker does not know the files up front - the analyzer information is stored in files named after the source files
+    AnalyzerInformation::writeFilesTxt(mSettings.buildDir, {}, {});
+
+    // the coordinator might not be listening yet
+    std::string err;
+    int fd = -1;
+    for (int retry = 0; retry < 600 && fd == -1; ++retry) {
+        fd = openSocket(mSettings.worker, false, err);
+        if (fd == -1)
+            usleep(100000);
+    }
+    if (fd == -1) {
+        std::cerr << "#### ProcessExecutor::work, failed to connect to '" << mSettings.worker << "': " << err << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    for (;;) {
+        char type = 0;
+        std::string jobData;
+        // the coordinator closes the connection when all files have been handed out
+        if (!readFrame(fd, type, jobData))
+            break;
+
+        std::string analyzerInfo;
+        ReceivedJob received;
+        if (type != SEND_JOB || !readFrame(fd, type, analyzerInfo) || type != SEND_ANALYZERINFO || !deserializeJob(jobData, received)) {
+            std::cerr << "#### ProcessExecutor::work, invalid job received from '" << mSettings.worker << "'" << std::endl;
+            close(fd);
+            return EXIT_FAILURE;
+        }
+
+        const FileWithDetails &file = received.fs ? received.fs->file : *received.file;
+        const Job job{received.file.get(), received.fs.get(), received.fs ? received.fs->filename() + ' ' + received.fs->cfg : file.path(), file.size(), 0};
+
+        // the results of the previous runs are stored by the coordinator
+        const std::string analyzerInfoFile = getAnalyzerInfoFile(mSettings.buildDir, job);
+        if (analyzerInfo.empty())
+            std::remove(analyzerInfoFile.c_str());
+        else {
+            std::ofstream fout(analyzerInfoFile, std::ios::binary);
+            fout << analyzerInfo;
+        }
+
+        Suppressions supprs;
+        supprs.nomsg.addSuppressions(mSuppressions.nomsg.getSuppressions());
+        supprs.nofail.addSuppressions(mSuppressions.nofail.getSuppressions());
+        checkJob(job, supprs, fd);
+    }
+
+    close(fd);
+    return EXIT_SUCCESS;
+}
+
 void ProcessExecutor::reportInternalChildErr(const std::string &childname, const std::string &msg)
 {
     std::list<ErrorMessage::FileLocation> locations;
@@ -27,6 +27,7 @@
 #include "executor.h"
 
 #include <cstddef>
+#include <cstdint>
 #include <list>
 #include <string>
 
@@ -52,12 +53,64 @@ public:
 
     unsigned int check() override;
 
+    /**
+     * @brief Check the files handed out by the coordinator (--worker) until it closes the connection
+     * @return EXIT_SUCCESS or EXIT_FAILURE if the coordinator could not be reached
+     */
+    int work();
+
 private:
+    enum class ReadResult : std::uint8_t {
+        /** more data is expected */
+        More,
+        /** the child has finished the file */
+        Done,
+        /** the pipe has been closed - i.e. the child has exited */
+        Closed
+    };
+
     /**
      * Read from the pipe, parse and handle what ever is in there.
-     * @return False in case of an recoverable error - will exit process on others
+     * @return Closed in case of an recoverable error - will exit process on others
+     */
+    ReadResult handleRead(int rpipe, unsigned int &result, const Job* job);
+
+    /**
+     * @brief Check a job in the child process and write the results to the pipe
+     * @param job the job to check
+     * @param supprs the suppressions - the changes are written to the pipe
+     * @param wpipe the pipe the results are written to
+     */
+    void checkJob(const Job &job, Suppressions &supprs, int wpipe) const;
+
+    /**
+     * @brief Load the headers included by the first job into the HeaderCache before forking
+     * so the children inherit them and do not have to lex them again
+     */
+    void prewarmHeaderCache(const std::vector<Job> &jobs) const;
+
+    /**
+     * @brief Check the files using a fixed set of long-lived child processes (--executor=process-pool)
+     * @return the sum of the results
+     */
+    unsigned int checkPool();
+
+    /**
+     * @brief Get the first pending job which can be started without exceeding --max-memory.
+     * A job is always started if nothing else is running so a file exceeding the limit on its
+     * own is still analyzed.
+     * @param pending the jobs which have not been started yet
+     * @param runningMemory the estimated memory usage of the running jobs
+     * @param running count of the running jobs
+     * @return pending.end() if none of the jobs can be started
+     */
+    std::list<const Job*>::iterator nextJob(std::list<const Job*> &pending, std::size_t runningMemory, std::size_t running) const;
+
+    /**
+     * @brief Hand out the files to the workers connecting on the --coordinator address
+     * @return the sum of the results
      */
-    bool handleRead(int rpipe, unsigned int &result, const std::string& filename);
+    unsigned int checkCoordinator();
 
     /**
      * @brief Check load average condition
@@ -28,6 +28,7 @@
 #include "suppressions.h"
 
 #include <cassert>
+#include <chrono>
 #include <cstdlib>
 #include <future>
 #include <iostream>
@@ -86,36 +87,20 @@ private:
 class ThreadData
 {
 public:
-    ThreadData(ThreadExecutor &threadExecutor, ErrorLogger &errorLogger, TimerResults *timerResults, const Settings &settings, Suppressions& supprs, const std::list<FileWithDetails> &files, const std::list<FileSettings> &fileSettings, CppCheck::ExecuteCmdFn executeCommand)
-        : mFiles(files), mFileSettings(fileSettings), mTimerResults(timerResults), mSettings(settings), mSuppressions(supprs), mExecuteCommand(std::move(executeCommand)), mLogForwarder(threadExecutor, errorLogger)
+    ThreadData(ThreadExecutor &threadExecutor, ErrorLogger &errorLogger, TimerResults *timerResults, const Settings &settings, Suppressions& supprs, std::vector<ThreadExecutor::Job> jobs, CppCheck::ExecuteCmdFn executeCommand)
+        : mThreadExecutor(threadExecutor), mJobs(std::move(jobs)), mTimerResults(timerResults), mSettings(settings), mSuppressions(supprs), mExecuteCommand(std::move(executeCommand)), mLogForwarder(threadExecutor, errorLogger)
     {
-        mItNextFile = mFiles.begin();
-        mItNextFileSettings = mFileSettings.begin();
-
-        mTotalFiles = mFiles.size() + mFileSettings.size();
-        mTotalFileSize = std::accumulate(mFiles.cbegin(), mFiles.cend(), std::size_t(0), [](std::size_t v, const FileWithDetails& p) {
-            return v + p.size();
+        mTotalFiles = mJobs.size();
+        mTotalFileSize = std::accumulate(mJobs.cbegin(), mJobs.cend(), std::size_t(0), [](std::size_t v, const ThreadExecutor::Job& job) {
+            return job.file ? v + job.size : v;
         });
     }
 
-    bool next(const FileWithDetails *&file, const FileSettings *&fs, std::size_t &fileSize) {
+    const ThreadExecutor::Job* next() {
         std::lock_guard<std::mutex> l(mFileSync);
-        if (mItNextFile != mFiles.end()) {
-            file = &(*mItNextFile);
-            fs = nullptr;
-            fileSize = mItNextFile->size();
-            ++mItNextFile;
-            return true;
-        }
-        if (mItNextFileSettings != mFileSettings.end()) {
-            file = nullptr;
-            fs = &(*mItNextFileSettings);
-            fileSize = 0;
-            ++mItNextFileSettings;
-            return true;
-        }
-
-        return false;
+        if (mNextJob != mJobs.size())
+            return &mJobs[mNextJob++];
+        return nullptr;
     }
 
     unsigned int check(const FileWithDetails *file, const FileSettings *fs) {
@@ -149,6 +134,10 @@ public:
         return result;
     }
 
+    void timing(const ThreadExecutor::Job &job, std::chrono::milliseconds elapsed) {
+        mThreadExecutor.addTiming(job, elapsed);
+    }
+
     void status(std::size_t fileSize) {
         std::lock_guard<std::mutex> l(mFileSync);
         mProcessedSize += fileSize;
@@ -158,10 +147,9 @@ public:
     }
 
 private:
-    const std::list<FileWithDetails> &mFiles;
-    std::list<FileWithDetails>::const_iterator mItNextFile;
-    const std::list<FileSettings> &mFileSettings;
-    std::list<FileSettings>::const_iterator mItNextFileSettings;
+    ThreadExecutor &mThreadExecutor;
+    const std::vector<ThreadExecutor::Job> mJobs;
+    std::size_t mNextJob{};
 
     std::size_t mProcessedFiles{};
     std::size_t mTotalFiles{};
@@ -181,14 +169,12 @@ static unsigned int STDCALL threadProc(ThreadData *data)
 {
     unsigned int result = 0;
 
-    const FileWithDetails *file;
-    const FileSettings *fs;
-    std::size_t fileSize;
+    while (const ThreadExecutor::Job *job = data->next()) {
+        const auto start = std::chrono::steady_clock::now();
+        result += data->check(job->file, job->fs);
+        data->timing(*job, std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start));
 
-    while (data->next(file, fs, fileSize)) {
-        result += data->check(file, fs);
-
-        data->status(fileSize);
+        data->status(job->file ? job->size : 0);
     }
 
     return result;
@@ -199,7 +185,7 @@ unsigned int ThreadExecutor::check()
     std::vector<std::future<unsigned int>> threadFutures;
     threadFutures.reserve(mSettings.jobs);
 
-    ThreadData data(*this, mErrorLogger, mTimerResults, mSettings, mSuppressions, mFiles, mFileSettings, mExecuteCommand);
+    ThreadData data(*this, mErrorLogger, mTimerResults, mSettings, mSuppressions, getJobs(), mExecuteCommand);
 
     for (unsigned int i = 0; i < mSettings.jobs; ++i) {
         try {
@@ -215,6 +201,8 @@ unsigned int ThreadExecutor::check()
         return v + f.get();
     });
 
+    writeTimings();
+
     return result;
 }
 
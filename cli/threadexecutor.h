@@ -44,6 +44,7 @@ class TimerResults;
  */
 class ThreadExecutor : public Executor {
     friend class SyncLogForwarder;
+    friend class ThreadData;
 
 public:
     ThreadExecutor(const std::list<FileWithDetails> &files, const std::list<FileSettings>& fileSettings, const Settings &settings, Suppressions &suppressions, ErrorLogger &errorLogger, TimerResults* timerResults, CppCheck::ExecuteCmdFn executeCommand);
@@ -60,6 +60,11 @@
 #  include <sys/types.h>
 #endif
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#  include <emmintrin.h>
+#  define SIMPLECPP_SSE2
+#endif
+
 static bool isHex(const std::string &s)
 {
     return s.size()>2 && (s.compare(0,2,"0x")==0 || s.compare(0,2,"0X")==0);
@@ -306,7 +311,41 @@ public:
             unget();
     }
 
+    /**
+     * Read a run of characters directly from the buffer of the stream. Only the
+     * characters which need no conversion can be read like this - so nothing is
+     * read from UTF-16 streams and a run must not contain '\r'.
+     * @param count  returns the length of the run at the start of the given bytes
+     * @param dst    the characters are appended to it unless it is nullptr
+     * @return the number of characters which have been read
+     */
+    template<class Count>
+    std::size_t readRun(const Count &count, TokenString *dst) {
+        if (isUtf16)
+            return 0;
+        std::size_t size = 0;
+        const unsigned char *data = buffered(size);
+        if (!data)
+            return 0;
+        const std::size_t n = count(data, size);
+        if (dst)
+            dst->append(reinterpret_cast<const char *>(data), n);
+        skip(n);
+        return n;
+    }
+
 protected:
+    /** @brief the bytes which have not been read yet - nullptr if they are not in a buffer */
+    virtual const unsigned char *buffered(std::size_t &size) {
+        size = 0;
+        return nullptr;
+    }
+
+    /** @brief skip bytes which have been returned by buffered() */
+    virtual void skip(std::size_t n) {
+        (void)n;
+    }
+
     void init() {
         // initialize since we use peek() in getAndSkipBOM()
         isUtf16 = false;
@@ -408,69 +447,34 @@ namespace {
             return lastStatus != EOF;
         }
 
+    protected:
+        const unsigned char *buffered(std::size_t &n) override {
+            n = pos < size ? size - pos : 0;
+            return str + pos;
+        }
+        void skip(std::size_t n) override {
+            pos += n;
+        }
+
     private:
         const unsigned char *str;
         const std::size_t size;
         std::size_t pos{};
         int lastStatus{};
     };
+}
 
-    class FileStream : public simplecpp::TokenList::Stream {
-    public:
-        /**
-         * @throws simplecpp::Output thrown if file is not found
-         */
-        // cppcheck-suppress uninitDerivedMemberVar - we call Stream::init() to initialize the private members
-        explicit FileStream(const std::string &filename, std::vector<std::string> &files)
-            : file(fopen(filename.c_str(), "rb"))
-        {
-            if (!file) {
-                files.emplace_back(filename);
-                throw simplecpp::Output(simplecpp::Output::FILE_NOT_FOUND, {}, "File is missing: " + filename);
-            }
-            init();
-        }
-
-        FileStream(const FileStream&) = delete;
-        FileStream &operator=(const FileStream&) = delete;
-
-        ~FileStream() override {
-            fclose(file);
-            file = nullptr;
-        }
-
-        int get() override {
-            lastStatus = lastCh = fgetc(file);
-            return lastCh;
-        }
-        int peek() override {
-            // keep lastCh intact
-            const int ch = fgetc(file);
-            unget_internal(ch);
-            return ch;
-        }
-        void unget() override {
-            unget_internal(lastCh);
-        }
-        bool good() override {
-            return lastStatus != EOF;
-        }
-
-    private:
-        void unget_internal(int ch) {
-            if (isUtf16) {
-                // TODO: use ungetc() as well
-                // UTF-16 has subsequent unget() calls
-                fseek(file, -1, SEEK_CUR);
-            } else {
-                ungetc(ch, file);
-            }
-        }
-
-        FILE *file;
-        int lastCh{};
-        int lastStatus{};
-    };
+static bool readFile(const std::string &filename, std::string &data)
+{
+    FILE *f = fopen(filename.c_str(), "rb");
+    if (!f)
+        return false;
+    char buf[65536];
+    std::size_t n;
+    while ((n = fread(buf, 1, sizeof(buf), f)) > 0)
+        data.append(buf, n);
+    fclose(f);
+    return true;
 }
 
 simplecpp::TokenList::TokenList(std::vector<std::string> &filenames) : frontToken(nullptr), backToken(nullptr), files(filenames) {}
@@ -492,12 +496,16 @@ simplecpp::TokenList::TokenList(const unsigned char* data, std::size_t size, std
 simplecpp::TokenList::TokenList(const std::string &filename, std::vector<std::string> &filenames, OutputList *outputList)
     : frontToken(nullptr), backToken(nullptr), files(filenames)
 {
-    try {
-        FileStream stream(filename, filenames);
-        readfile(stream,filename,outputList);
-    } catch (const simplecpp::Output & e) {
-        outputList->emplace_back(e);
+    // the whole file is read at once so it can be lexed from the buffer
+    std::string data;
+    if (!readFile(filename, data)) {
+        files.emplace_back(filename);
+        if (outputList)
+            outputList->emplace_back(Output::FILE_NOT_FOUND, Location(), "File is missing: " + filename);
+        return;
     }
+    StdCharBufStream stream(reinterpret_cast<const unsigned char *>(data.data()), data.size());
+    readfile(stream,filename,outputList);
 }
 
 simplecpp::TokenList::TokenList(const TokenList &other) : frontToken(nullptr), backToken(nullptr), files(other.files)
@@ -608,6 +616,96 @@ static bool isNameChar(int ch)
     return std::isalnum(ch) || ch == '_' || ch == '$';
 }
 
+// The lexer scans runs of characters of a single class (whitespace, name, comment and
+// string contents) directly in the buffer of the stream. With SSE2 16 characters are
+// classified at once.
+#ifdef SIMPLECPP_SSE2
+// number of leading set bits in the 16-bit mask
+static std::size_t countLeadingMatches(unsigned int mask)
+{
+    std::size_t n = 0;
+    while (mask & 1U) {
+        mask >>= 1;
+        ++n;
+    }
+    return n;
+}
+
+static __m128i inRange(__m128i v, unsigned char lo, unsigned char hi)
+{
+    const __m128i min = _mm_max_epu8(v, _mm_set1_epi8(static_cast<char>(lo)));
+    const __m128i max = _mm_min_epu8(v, _mm_set1_epi8(static_cast<char>(hi)));
+    return _mm_and_si128(_mm_cmpeq_epi8(min, v), _mm_cmpeq_epi8(max, v));
+}
+#endif
+
+static bool isSpaceRunChar(unsigned char ch)
+{
+    return ch <= ' ' && ch != '\n' && ch != '\r';
+}
+
+/** number of leading whitespace characters - newlines are not included */
+static std::size_t countSpaceChars(const unsigned char *p, std::size_t size)
+{
+    std::size_t n = 0;
+#ifdef SIMPLECPP_SSE2
+    for (; n + 16 <= size; n += 16) {
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p + n));
+        const __m128i space = _mm_cmpeq_epi8(_mm_min_epu8(v, _mm_set1_epi8(' ')), v);
+        const __m128i newline = _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8('\n')), _mm_cmpeq_epi8(v, _mm_set1_epi8('\r')));
+        const auto mask = static_cast<unsigned int>(_mm_movemask_epi8(_mm_andnot_si128(newline, space)));
+        if (mask != 0xffffU)
+            return n + countLeadingMatches(mask);
+    }
+#endif
+    while (n < size && isSpaceRunChar(p[n]))
+        ++n;
+    return n;
+}
+
+/** number of leading name characters */
+static std::size_t countNameChars(const unsigned char *p, std::size_t size)
+{
+    std::size_t n = 0;
+#ifdef SIMPLECPP_SSE2
+    for (; n + 16 <= size; n += 16) {
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p + n));
+        const __m128i letter = inRange(_mm_or_si128(v, _mm_set1_epi8(0x20)), 'a', 'z');
+        const __m128i digit = inRange(v, '0', '9');
+        const __m128i other = _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8('_')), _mm_cmpeq_epi8(v, _mm_set1_epi8('$')));
+        const auto mask = static_cast<unsigned int>(_mm_movemask_epi8(_mm_or_si128(_mm_or_si128(letter, digit), other)));
+        if (mask != 0xffffU)
+            return n + countLeadingMatches(mask);
+    }
+#endif
+    while (n < size && isNameChar(p[n]))
+        ++n;
+    return n;
+}
+
+/** number of leading characters which are none of the given characters */
+static std::size_t countCharsNotIn(const unsigned char *p, std::size_t size, const char (&chars)[4])
+{
+    std::size_t n = 0;
+#ifdef SIMPLECPP_SSE2
+    const __m128i c0 = _mm_set1_epi8(chars[0]);
+    const __m128i c1 = _mm_set1_epi8(chars[1]);
+    const __m128i c2 = _mm_set1_epi8(chars[2]);
+    const __m128i c3 = _mm_set1_epi8(chars[3]);
+    for (; n + 16 <= size; n += 16) {
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p + n));
+        const __m128i found = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(v, c0), _mm_cmpeq_epi8(v, c1)),
+                                           _mm_or_si128(_mm_cmpeq_epi8(v, c2), _mm_cmpeq_epi8(v, c3)));
+        const auto mask = static_cast<unsigned int>(_mm_movemask_epi8(found));
+        if (mask != 0)
+            return n + countLeadingMatches(~mask);
+    }
+#endif
+    while (n < size && p[n] != chars[0] && p[n] != chars[1] && p[n] != chars[2] && p[n] != chars[3])
+        ++n;
+    return n;
+}
+
 static std::string escapeString(const std::string &str)
 {
     std::ostringstream ostr;
@@ -743,7 +841,7 @@ void simplecpp::TokenList::readfile(Stream &stream, const std::string &filename,
         }
 
         if (ch <= ' ') {
-            location.col++;
+            location.col += 1 + stream.readRun(countSpaceChars, nullptr);
             continue;
         }
 
@@ -783,6 +881,7 @@ void simplecpp::TokenList::readfile(Stream &stream, const std::string &filename,
             const bool num = !!std::isdigit(ch);
             while (stream.good() && isNameChar(ch)) {
                 currentToken += ch;
+                stream.readRun(countNameChars, &currentToken);
                 ch = stream.readChar();
                 if (num && ch=='\'' && isNameChar(stream.peekChar()))
                     ch = stream.readChar();
@@ -835,6 +934,11 @@ void simplecpp::TokenList::readfile(Stream &stream, const std::string &filename,
                 currentToken += ch;
                 if (currentToken.size() >= 4U && endsWith(currentToken, COMMENT_END))
                     break;
+                if (ch != '*') {
+                    stream.readRun([](const unsigned char *p, std::size_t size) {
+                        return countCharsNotIn(p, size, {'*', '\r', '*', '*'});
+                    }, &currentToken);
+                }
                 ch = stream.readChar();
             }
             // multiline..
@@ -1405,9 +1509,15 @@ std::string simplecpp::TokenList::readUntil(Stream &stream, const Location &loca
     std::string ret;
     ret += start;
 
+    const char plainEnd[4] = {end, '\\', '\r', '\n'};
     bool backslash = false;
     char ch = 0;
     while (ch != end && ch != '\r' && ch != '\n' && stream.good()) {
+        if (!backslash) {
+            stream.readRun([&plainEnd](const unsigned char *p, std::size_t size) {
+                return countCharsNotIn(p, size, plainEnd);
+            }, &ret);
+        }
         ch = stream.readChar();
         if (backslash && ch == '\n') {
             ch = 0;
@@ -3145,7 +3255,7 @@ std::pair<simplecpp::FileData *, bool> simplecpp::FileDataCache::tryload(FileDat
         return {id_it->second, false};
     }
 
-    auto *const data = new FileData {path, TokenList(path, filenames, outputList)};
+    auto *const data = new FileData {path, mLexCallback ? mLexCallback(path, filenames, outputList) : TokenList(path, filenames, outputList)};
 
     if (dui.removeComments)
         data->tokens.removeComments();
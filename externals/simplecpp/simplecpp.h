@@ -505,6 +505,13 @@ namespace simplecpp {
             mLoadCallback = std::move(cb);
         }
 
+        /** Function which lexes a file that is not cached yet - by default the file is read and lexed by the TokenList */
+        using lex_callback_type = std::function<TokenList (const std::string &path, std::vector<std::string> &filenames, OutputList *outputList)>;
+
+        void set_lex_callback(lex_callback_type cb) {
+            mLexCallback = std::move(cb);
+        }
+
     private:
         struct Impl;
         std::unique_ptr<Impl> mImpl;
@@ -516,6 +523,7 @@ namespace simplecpp {
         container_type mData;
         name_map_type mNameMap;
         load_callback_type mLoadCallback;
+        lex_callback_type mLexCallback;
     };
 
     /** Converts character literal (including prefix, but not ud-suffix) to long long value.
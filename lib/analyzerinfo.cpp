@@ -20,20 +20,193 @@
 
 #include "errorlogger.h"
 #include "filesettings.h"
+#include "mappedfile.h"
 #include "path.h"
 #include "utils.h"
 
+#include <algorithm>
 #include <array>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
 #include <cstring>
 #include <exception>
+#include <iomanip>
 #include <iostream>
+#include <iterator>
 #include <map>
+#include <random>
 #include <sstream>
 #include <stdexcept>
 #include <utility>
 
+#include <sys/stat.h>
+
 #include "xml.h"
 
+namespace {
+    /**
+     * Layout of an analyzer information file (native byte order):
+     * - header: magic, version, hash, number of entries
+     * - index: kind, name size, offset, data size of each entry
+     * - the name of each entry immediately followed by its data
+     */
+    constexpr std::array<char, 4> magic{{'C', 'P', 'A', 'I'}};
+    constexpr std::uint32_t version = 1;
+    constexpr std::size_t headerSize = 4 + 4 + 8 + 8;
+    constexpr std::size_t indexEntrySize = 4 + 4 + 8 + 8;
+
+    template<class T>
+    void put(std::string &out, T value)
+    {
+        char buf[sizeof(T)];
+        std::memcpy(buf, &value, sizeof(T));
+        out.append(buf, sizeof(T));
+    }
+
+    template<class T>
+    T get(const char *data)
+    {
+        T value;
+        std::memcpy(&value, data, sizeof(T));
+        return value;
+    }
+
+    /** Entry in a memory-mapped analyzer information file */
+    struct EntryView {
+        char kind;
+        const char *name;
+        std::size_t nameSize;
+        const char *data;
+        std::uint64_t dataSize;
+
+        bool nameIs(const char *s) const {
+            return std::strlen(s) == nameSize && std::memcmp(name, s, nameSize) == 0;
+        }
+    };
+
+    /**
+     * Parse the header and the index of an analyzer information file. The entries are not copied.
+     * @return error message, empty on success
+     */
+    std::string parseAnalyzerInfo(const char *data, std::size_t size, std::size_t &hash, std::vector<EntryView> &entries)
+    {
+        if (size < headerSize || std::memcmp(data, magic.data(), magic.size()) != 0)
+            return "not an analyzer information file";
+        if (get<std::uint32_t>(data + 4) != version)
+            return "unsupported version";
+        hash = get<std::uint64_t>(data + 8);
+        const std::uint64_t count = get<std::uint64_t>(data + 16);
+        if (count > (size - headerSize) / indexEntrySize)
+            return "truncated index";
+        entries.clear();
+        entries.reserve(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            const char * const e = data + headerSize + (i * indexEntrySize);
+            const std::uint32_t nameSize = get<std::uint32_t>(e + 4);
+            const std::uint64_t offset = get<std::uint64_t>(e + 8);
+            const std::uint64_t dataSize = get<std::uint64_t>(e + 16);
+            if (offset > size || nameSize > size - offset || dataSize > size - offset - nameSize)
+                return "invalid entry";
+            entries.push_back({static_cast<char>(get<std::uint32_t>(e)), data + offset, nameSize, data + offset + nameSize, dataSize});
+        }
+        return "";
+    }
+
+    /**
+     * Load the error messages. The findings are discarded if the analysis failed.
+     * @return error message, empty on success
+     */
+    std::string loadErrors(const std::vector<EntryView> &entries, std::list<ErrorMessage> &errors)
+    {
+        for (const EntryView &e : entries) {
+            if (e.kind != 'E')
+                continue;
+
+            // TODO: discarding results on internalError doesn't make sense since that won't fix itself
+            // Check for invalid license error or internal error, in which case we should retry analysis
+            static const std::array<const char*, 3> s_ids{
+                "premium-invalidLicense",
+                "premium-internalError",
+                "internalError"
+            };
+            for (const auto* id : s_ids)
+            {
+                // cppcheck-suppress useStlAlgorithm
+                if (e.nameIs(id)) {
+                    errors.clear();
+                    return std::string("'") + id + "' encountered";
+                }
+            }
+
+            ErrorMessage msg;
+            try {
+                msg.deserialize(std::string(e.data, e.dataSize));
+            } catch (const InternalError &) {
+                errors.clear();
+                return "invalid error message";
+            }
+            errors.push_back(std::move(msg));
+        }
+        return "";
+    }
+
+    /** Size and modification time (with the best available resolution) of a file */
+    std::string getFileStamp(const std::string &filename)
+    {
+        struct stat st;
+        if (stat(filename.c_str(), &st) != 0)
+            return "";
+        std::uint64_t mtime = static_cast<std::uint64_t>(st.st_mtime) * 1000000000;
+#if defined(__APPLE__) && defined(__MACH__)
+        mtime += st.st_mtimespec.tv_nsec;
+#elif defined(__linux__)
+        mtime += st.st_mtim.tv_nsec;
+#endif
+        std::string ret;
+        put<std::uint64_t>(ret, st.st_size);
+        put<std::uint64_t>(ret, mtime);
+        return ret;
+    }
+
+    /** Hash of the content of a file - used if only the modification time of a file has changed */
+    bool getContentHash(const std::string &filename, std::uint64_t &hash)
+    {
+        std::ifstream fin(filename, std::ios::binary);
+        if (!fin.is_open())
+            return false;
+        std::ostringstream oss;
+        oss << fin.rdbuf();
+        hash = std::hash<std::string>{}(oss.str());
+        return true;
+    }
+
+    /** The cache dir is shared by several processes so the file is written under a unique name and then renamed */
+    void writeCacheFile(const std::string &cacheFile, const std::string &data)
+    {
+        std::ostringstream tmpFile;
+        tmpFile << cacheFile << '.' << std::hex << std::random_device{}() << std::chrono::steady_clock::now().time_since_epoch().count() << ".tmp";
+        {
+            std::ofstream fout(tmpFile.str(), std::ios::binary);
+            if (!fout.is_open())
+                return;
+            fout << data;
+            if (!fout.good()) {
+                fout.close();
+                std::remove(tmpFile.str().c_str());
+                return;
+            }
+        }
+        // fails on Windows if another process has already stored the same result
+        if (std::rename(tmpFile.str().c_str(), cacheFile.c_str()) != 0)
+            std::remove(tmpFile.str().c_str());
+    }
+}
+
+AnalyzerInformation::AnalyzerInformation(std::string cacheDir)
+    : mCacheDir(std::move(cacheDir))
+{}
+
 AnalyzerInformation::~AnalyzerInformation()
 {
     close();
@@ -80,50 +253,56 @@ std::string AnalyzerInformation::getFilesTxt(const std::list<std::string> &sourc
 void AnalyzerInformation::close()
 {
     if (mOutputStream.is_open()) {
-        mOutputStream << "</analyzerinfo>\n";
+        const std::string data = serialize(mHash, mEntries);
+        mOutputStream << data;
         mOutputStream.close();
+        mEntries.clear();
+        if (!mCacheFile.empty()) {
+            writeCacheFile(mCacheFile, data);
+            mCacheFile.clear();
+        }
+        if (mDebug) {
+            std::ofstream fout(mAnalyzerInfoFile + ".xml");
+            const std::string err = exportXml(mAnalyzerInfoFile, fout);
+            if (!err.empty())
+                std::cout << "failed to export '" << mAnalyzerInfoFile << "' - " << err << std::endl;
+        }
     }
 }
 
-std::string AnalyzerInformation::skipAnalysis(const tinyxml2::XMLDocument &analyzerInfoDoc, std::size_t hash, std::list<ErrorMessage> &errors)
+std::string AnalyzerInformation::serialize(std::size_t hash, const std::vector<Entry> &entries)
 {
-    const tinyxml2::XMLElement * const rootNode = analyzerInfoDoc.FirstChildElement();
-    if (rootNode == nullptr)
-        return "no root node found";
-
-    if (strcmp(rootNode->Name(), "analyzerinfo") != 0)
-        return "unexpected root node";
+    std::string ret;
+    ret.append(magic.data(), magic.size());
+    put<std::uint32_t>(ret, version);
+    put<std::uint64_t>(ret, hash);
+    put<std::uint64_t>(ret, entries.size());
+    std::uint64_t offset = headerSize + (entries.size() * indexEntrySize);
+    for (const Entry &e : entries) {
+        put<std::uint32_t>(ret, static_cast<unsigned char>(e.kind));
+        put<std::uint32_t>(ret, e.name.size());
+        put<std::uint64_t>(ret, offset);
+        put<std::uint64_t>(ret, e.data.size());
+        offset += e.name.size() + e.data.size();
+    }
+    for (const Entry &e : entries) {
+        ret += e.name;
+        ret += e.data;
+    }
+    return ret;
+}
 
-    const char * const attr = rootNode->Attribute("hash");
-    if (!attr)
-        return "no 'hash' attribute found";
-    if (attr != std::to_string(hash))
+std::string AnalyzerInformation::skipAnalysis(const char *data, std::size_t size, std::size_t hash, std::list<ErrorMessage> &errors)
+{
+    std::size_t fileHash = 0;
+    std::vector<EntryView> entries;
+    const std::string err = parseAnalyzerInfo(data, size, fileHash, entries);
+    if (!err.empty())
+        return err;
+    if (fileHash != hash)
         return "hash mismatch";
 
-    for (const tinyxml2::XMLElement *e = rootNode->FirstChildElement(); e; e = e->NextSiblingElement()) {
-        if (std::strcmp(e->Name(), "error") != 0)
-            continue;
-
-        // TODO: discarding results on internalError doesn't make sense since that won't fix itself
-        // Check for invalid license error or internal error, in which case we should retry analysis
-        static const std::array<const char*, 3> s_ids{
-            "premium-invalidLicense",
-            "premium-internalError",
-            "internalError"
-        };
-        for (const auto* id : s_ids)
-        {
-            // cppcheck-suppress useStlAlgorithm
-            if (e->Attribute("id", id)) {
-                errors.clear();
-                return std::string("'") + id + "' encountered";
-            }
-        }
-
-        errors.emplace_back(e);
-    }
-
-    return "";
+    return loadErrors(entries, errors);
 }
 
 std::string AnalyzerInformation::getAnalyzerInfoFileFromFilesTxt(std::istream& filesTxt, const std::string &sourcefile, const std::string &cfg, size_t fsFileId)
@@ -158,6 +337,15 @@ std::string AnalyzerInformation::getAnalyzerInfoFile(const std::string &buildDir
     return Path::join(buildDir, std::move(filename)) + ".analyzerinfo";
 }
 
+std::string AnalyzerInformation::getCacheFile(const std::string &cacheDir, const std::string &sourcefile, const std::string &cfg, std::size_t hash)
+{
+    // the findings refer to the file so it is part of the key
+    const std::size_t key = std::hash<std::string>{}(std::to_string(hash) + sep + cfg + sep + Path::simplifyPath(sourcefile));
+    std::ostringstream filename;
+    filename << std::hex << std::setw(16) << std::setfill('0') << key << ".a";
+    return Path::join(cacheDir, filename.str());
+}
+
 bool AnalyzerInformation::analyzeFile(const std::string &buildDir, const std::string &sourcefile, const std::string &cfg, std::size_t fsFileId, std::size_t hash, std::list<ErrorMessage> &errors, bool debug)
 {
     if (mOutputStream.is_open())
@@ -169,10 +357,10 @@ bool AnalyzerInformation::analyzeFile(const std::string &buildDir, const std::st
     const std::string analyzerInfoFile = AnalyzerInformation::getAnalyzerInfoFile(buildDir,sourcefile,cfg,fsFileId);
 
     {
-        tinyxml2::XMLDocument analyzerInfoDoc;
-        const tinyxml2::XMLError xmlError = analyzerInfoDoc.LoadFile(analyzerInfoFile.c_str());
-        if (xmlError == tinyxml2::XML_SUCCESS) {
-            const std::string err = skipAnalysis(analyzerInfoDoc, hash, errors);
+        MappedFile analyzerInfo;
+        bool notFound = false;
+        if (analyzerInfo.open(analyzerInfoFile, notFound)) {
+            const std::string err = skipAnalysis(analyzerInfo.data(), analyzerInfo.size(), hash, errors);
             if (err.empty()) {
                 if (debug)
                     std::cout << "skipping analysis - loaded " << errors.size() << " cached finding(s) from '" << analyzerInfoFile << "' for '" << sourcefile <<  "'" << std::endl;
@@ -182,19 +370,44 @@ bool AnalyzerInformation::analyzeFile(const std::string &buildDir, const std::st
                 std::cout << "discarding cached result from '" << analyzerInfoFile << "' for '" << sourcefile << "' - " << err << std::endl;
             }
         }
-        else if (xmlError != tinyxml2::XML_ERROR_FILE_NOT_FOUND) {
+        else if (!notFound) {
             if (debug)
-                std::cout << "discarding cached result - failed to load '" << analyzerInfoFile << "' for '" << sourcefile << "' (" << tinyxml2::XMLDocument::ErrorIDToName(xmlError) << ")" << std::endl;
+                std::cout << "discarding cached result - failed to load '" << analyzerInfoFile << "' for '" << sourcefile << "'" << std::endl;
         }
         else if (debug)
             std::cout << "no cached result '" << analyzerInfoFile << "' for '" << sourcefile << "' found" << std::endl;
     }
 
-    mOutputStream.open(analyzerInfoFile);
+    if (!mCacheDir.empty()) {
+        mCacheFile = getCacheFile(mCacheDir, sourcefile, cfg, hash);
+
+        MappedFile cached;
+        bool notFound = false;
+        if (cached.open(mCacheFile, notFound)) {
+            const std::string err = skipAnalysis(cached.data(), cached.size(), hash, errors);
+            if (err.empty()) {
+                // the whole program analysis reads the data from the build dir
+                std::ofstream fout(analyzerInfoFile, std::ios::binary);
+                fout.write(cached.data(), cached.size());
+                if (debug)
+                    std::cout << "skipping analysis - loaded " << errors.size() << " cached finding(s) from '" << mCacheFile << "' for '" << sourcefile << "'" << std::endl;
+                mCacheFile.clear();
+                return false;
+            }
+            if (debug)
+                std::cout << "discarding cached result from '" << mCacheFile << "' for '" << sourcefile << "' - " << err << std::endl;
+        }
+        else if (debug)
+            std::cout << "no cached result '" << mCacheFile << "' for '" << sourcefile << "' found" << std::endl;
+    }
+
+    // the file is written when it is closed
+    mOutputStream.open(analyzerInfoFile, std::ios::binary);
     if (!mOutputStream.is_open())
         throw std::runtime_error("failed to open '" + analyzerInfoFile + "'");
-    mOutputStream << "<?xml version=\"1.0\"?>\n";
-    mOutputStream << "<analyzerinfo hash=\"" << hash << "\">\n";
+    mAnalyzerInfoFile = analyzerInfoFile;
+    mHash = hash;
+    mDebug = debug;
 
     return true;
 }
@@ -202,13 +415,108 @@ bool AnalyzerInformation::analyzeFile(const std::string &buildDir, const std::st
 void AnalyzerInformation::reportErr(const ErrorMessage &msg)
 {
     if (mOutputStream.is_open())
-        mOutputStream << msg.toXML() << '\n';
+        mEntries.push_back({'E', msg.id, msg.serialize()});
 }
 
 void AnalyzerInformation::setFileInfo(const std::string &check, const std::string &fileInfo)
 {
     if (mOutputStream.is_open() && !fileInfo.empty())
-        mOutputStream << "  <FileInfo check=\"" << check << "\">\n" << fileInfo << "  </FileInfo>\n";
+        mEntries.push_back({'F', check, "  <FileInfo check=\"" + check + "\">\n" + fileInfo + "  </FileInfo>\n"});
+}
+
+void AnalyzerInformation::setDependencies(std::size_t optionsHash, const std::vector<std::string> &files)
+{
+    if (!mOutputStream.is_open())
+        return;
+
+    std::vector<Entry> dependencies;
+    for (const std::string &f : files) {
+        std::string stamp = getFileStamp(f);
+        std::uint64_t contentHash = 0;
+        if (stamp.empty() || !getContentHash(f, contentHash))
+            return;
+        put<std::uint64_t>(stamp, contentHash);
+        dependencies.push_back({'D', f, std::move(stamp)});
+    }
+
+    std::string hash;
+    put<std::uint64_t>(hash, optionsHash);
+    mEntries.push_back({'O', "", std::move(hash)});
+    mEntries.insert(mEntries.end(), std::make_move_iterator(dependencies.begin()), std::make_move_iterator(dependencies.end()));
+}
+
+bool AnalyzerInformation::skipUnchanged(const std::string &buildDir, const std::string &sourcefile, const std::string &cfg, std::size_t fsFileId, std::size_t optionsHash, std::list<ErrorMessage> &errors, bool debug)
+{
+    if (buildDir.empty() || sourcefile.empty())
+        return false;
+
+    const std::string analyzerInfoFile = AnalyzerInformation::getAnalyzerInfoFile(buildDir,sourcefile,cfg,fsFileId);
+
+    MappedFile analyzerInfo;
+    bool notFound = false;
+    if (!analyzerInfo.open(analyzerInfoFile, notFound))
+        return false;
+
+    std::size_t hash = 0;
+    std::vector<EntryView> entries;
+    if (!parseAnalyzerInfo(analyzerInfo.data(), analyzerInfo.size(), hash, entries).empty())
+        return false;
+
+    // the dependencies are only recorded if the analysis was completed
+    const auto options = std::find_if(entries.cbegin(), entries.cend(), [](const EntryView &e) {
+        return e.kind == 'O';
+    });
+    if (options == entries.cend() || options->dataSize != sizeof(std::uint64_t))
+        return false;
+    if (get<std::uint64_t>(options->data) != optionsHash) {
+        if (debug)
+            std::cout << "cached result '" << analyzerInfoFile << "' for '" << sourcefile << "' is outdated - the options have changed" << std::endl;
+        return false;
+    }
+
+    // the files are only read if their modification time has changed (i.e. after switching branches)
+    bool touched = false;
+    std::vector<Entry> refreshed;
+    for (const EntryView &e : entries) {
+        if (e.kind != 'D') {
+            refreshed.push_back({e.kind, std::string(e.name, e.nameSize), std::string(e.data, e.dataSize)});
+            continue;
+        }
+        const std::string dependency(e.name, e.nameSize);
+        std::string stamp = getFileStamp(dependency);
+        bool unchanged = false;
+        if (e.dataSize == stamp.size() + sizeof(std::uint64_t)) {
+            if (std::memcmp(stamp.data(), e.data, stamp.size()) == 0)
+                unchanged = true;
+            else if (std::memcmp(stamp.data(), e.data, sizeof(std::uint64_t)) == 0) {
+                std::uint64_t contentHash = 0;
+                unchanged = getContentHash(dependency, contentHash) && contentHash == get<std::uint64_t>(e.data + stamp.size());
+                touched = unchanged;
+            }
+        }
+        if (!unchanged) {
+            if (debug)
+                std::cout << "cached result '" << analyzerInfoFile << "' for '" << sourcefile << "' is outdated - '" << dependency << "' has changed" << std::endl;
+            return false;
+        }
+        stamp.append(e.data + stamp.size(), sizeof(std::uint64_t));
+        refreshed.push_back({'D', dependency, std::move(stamp)});
+    }
+
+    if (!loadErrors(entries, errors).empty())
+        return false;
+
+    if (debug)
+        std::cout << "skipping analysis - loaded " << errors.size() << " cached finding(s) from '" << analyzerInfoFile << "' for '" << sourcefile << "' - no file has changed" << std::endl;
+
+    // record the new modification times so the files do not need to be read again
+    if (touched) {
+        entries.clear();
+        analyzerInfo.close();
+        std::ofstream fout(analyzerInfoFile, std::ios::binary);
+        fout << serialize(hash, refreshed);
+    }
+    return true;
 }
 
 // TODO: report detailed errors?
@@ -239,7 +547,7 @@ bool AnalyzerInformation::Info::parse(const std::string& filesTxtLine) {
     return true;
 }
 
-std::string AnalyzerInformation::processFilesTxt(const std::string& buildDir, const std::function<void(const char* checkattr, const tinyxml2::XMLElement* e, const Info& filesTxtInfo)>& handler, bool debug)
+std::string AnalyzerInformation::processFilesTxt(const std::string& buildDir, const std::function<void(const char* checkattr, const tinyxml2::XMLElement* e, const Info& filesTxtInfo)>& handler, bool debug, const std::string& check)
 {
     const std::string filesTxt(buildDir + "/files.txt");
     std::ifstream fin(filesTxt.c_str());
@@ -252,41 +560,43 @@ std::string AnalyzerInformation::processFilesTxt(const std::string& buildDir, co
         if (filesTxtInfo.afile.empty())
             return "empty afile from '" + filesTxt + "'";
 
-        const std::string xmlfile = buildDir + '/' + filesTxtInfo.afile;
+        const std::string afile = buildDir + '/' + filesTxtInfo.afile;
 
-        tinyxml2::XMLDocument doc;
-        const tinyxml2::XMLError error = doc.LoadFile(xmlfile.c_str());
-        if (error == tinyxml2::XML_ERROR_FILE_NOT_FOUND) {
+        MappedFile analyzerInfo;
+        bool notFound = false;
+        const bool opened = analyzerInfo.open(afile, notFound);
+        if (!opened && notFound) {
             /* FIXME: this can currently not be reported as an error because:
              * - --clang does not generate any analyzer information - see #14456
              * - markup files might not generate analyzer information
              * - files with preprocessor errors might not generate analyzer information
              */
             if (debug)
-                std::cout << "'" + xmlfile + "' from '" + filesTxt + "' not found";
+                std::cout << "'" + afile + "' from '" + filesTxt + "' not found";
             continue;
         }
 
-        if (error != tinyxml2::XML_SUCCESS)
-            return "failed to load '" + xmlfile + "' from '" + filesTxt + "'";
-
-        const tinyxml2::XMLElement * const rootNode = doc.FirstChildElement();
-        if (rootNode == nullptr)
-            return "no root node found in '" + xmlfile + "' from '" + filesTxt + "'";
+        if (!opened)
+            return "failed to load '" + afile + "' from '" + filesTxt + "'";
 
-        if (strcmp(rootNode->Name(), "analyzerinfo") != 0)
-            return "unexpected root node in '" + xmlfile + "' from '" + filesTxt + "'";
+        std::size_t hash = 0;
+        std::vector<EntryView> entries;
+        const std::string err = parseAnalyzerInfo(analyzerInfo.data(), analyzerInfo.size(), hash, entries);
+        if (!err.empty())
+            return "failed to load '" + afile + "' from '" + filesTxt + "' - " + err;
 
-        for (const tinyxml2::XMLElement *e = rootNode->FirstChildElement(); e; e = e->NextSiblingElement()) {
-            if (std::strcmp(e->Name(), "FileInfo") != 0)
-                continue;
-            const char *checkattr = e->Attribute("check");
-            if (checkattr == nullptr) {
-                if (debug)
-                    std::cout << "'check' attribute missing in 'FileInfo' in '" << xmlfile << "' from '" << filesTxt + "'";
+        for (const EntryView &entry : entries) {
+            if (entry.kind != 'F' || (!check.empty() && !entry.nameIs(check.c_str())))
                 continue;
-            }
-            handler(checkattr, e, filesTxtInfo);
+            // only the data which is actually used is parsed
+            tinyxml2::XMLDocument doc;
+            const tinyxml2::XMLElement *e = nullptr;
+            if (doc.Parse(entry.data, entry.dataSize) == tinyxml2::XML_SUCCESS)
+                e = doc.FirstChildElement("FileInfo");
+            if (e == nullptr)
+                return "failed to load 'FileInfo' in '" + afile + "' from '" + filesTxt + "'";
+            const std::string checkattr(entry.name, entry.nameSize);
+            handler(checkattr.c_str(), e, filesTxtInfo);
         }
     }
 
@@ -294,23 +604,118 @@ std::string AnalyzerInformation::processFilesTxt(const std::string& buildDir, co
     return "";
 }
 
+AnalyzerInformation::Timings AnalyzerInformation::parseTimingsTxt(std::istream& timingsTxt)
+{
+    Timings timings;
+    std::string line;
+    while (std::getline(timingsTxt, line)) {
+        const std::string::size_type pos = line.find(sep);
+        if (pos == std::string::npos || pos == 0 || pos + 1 == line.size())
+            continue; // TODO: report error?
+        std::size_t time;
+        if (!strToInt(line.substr(0, pos), time))
+            continue; // TODO: report error?
+        timings[line.substr(pos + 1)] = time;
+    }
+    return timings;
+}
+
+std::string AnalyzerInformation::getTimingsTxt(const Timings &timings)
+{
+    std::ostringstream ret;
+    for (const auto& t : timings)
+        ret << t.second << sep << t.first << '\n';
+    return ret.str();
+}
+
+AnalyzerInformation::Timings AnalyzerInformation::readTimingsTxt(const std::string &buildDir)
+{
+    std::ifstream fin(Path::join(buildDir, "timings.txt"));
+    if (!fin.is_open())
+        return {};
+    return parseTimingsTxt(fin);
+}
+
+void AnalyzerInformation::writeTimingsTxt(const std::string &buildDir, const Timings &timings)
+{
+    std::ofstream fout(Path::join(buildDir, "timings.txt"));
+    fout << getTimingsTxt(timings);
+}
+
+// uses the same format as timings.txt
+AnalyzerInformation::PeakMemory AnalyzerInformation::readPeakMemoryTxt(const std::string &buildDir)
+{
+    std::ifstream fin(Path::join(buildDir, "peakmemory.txt"));
+    if (!fin.is_open())
+        return {};
+    return parseTimingsTxt(fin);
+}
+
+void AnalyzerInformation::writePeakMemoryTxt(const std::string &buildDir, const PeakMemory &peakMemory)
+{
+    std::ofstream fout(Path::join(buildDir, "peakmemory.txt"));
+    fout << getTimingsTxt(peakMemory);
+}
+
 void AnalyzerInformation::reopen(const std::string &buildDir, const std::string &sourcefile, const std::string &cfg, std::size_t fsFileId)
 {
     if (buildDir.empty() || sourcefile.empty())
         return;
 
     const std::string analyzerInfoFile = AnalyzerInformation::getAnalyzerInfoFile(buildDir,sourcefile,cfg,fsFileId);
-    std::ifstream ifs(analyzerInfoFile);
-    if (!ifs.is_open())
-        return;
-
-    std::ostringstream iss;
-    iss << ifs.rdbuf();
-    ifs.close();
+    {
+        MappedFile analyzerInfo;
+        bool notFound = false;
+        if (!analyzerInfo.open(analyzerInfoFile, notFound))
+            return;
+
+        std::vector<EntryView> entries;
+        if (!parseAnalyzerInfo(analyzerInfo.data(), analyzerInfo.size(), mHash, entries).empty())
+            return;
+
+        mEntries.clear();
+        for (const EntryView &e : entries)
+            mEntries.push_back({e.kind, std::string(e.name, e.nameSize), std::string(e.data, e.dataSize)});
+    }
 
-    std::string content = iss.str();
-    content.resize(content.find("</analyzerinfo>"));
+    // the file is rewritten with the additional entries when it is closed
+    mOutputStream.open(analyzerInfoFile, std::ios::binary | std::ios::trunc);
+    mAnalyzerInfoFile = analyzerInfoFile;
+    mDebug = false;
+}
 
-    mOutputStream.open(analyzerInfoFile, std::ios::trunc);
-    mOutputStream << content;
+std::string AnalyzerInformation::exportXml(const std::string &analyzerInfoFile, std::ostream &out)
+{
+    MappedFile analyzerInfo;
+    bool notFound = false;
+    if (!analyzerInfo.open(analyzerInfoFile, notFound))
+        return notFound ? "file not found" : "failed to load file";
+
+    std::size_t hash = 0;
+    std::vector<EntryView> entries;
+    const std::string err = parseAnalyzerInfo(analyzerInfo.data(), analyzerInfo.size(), hash, entries);
+    if (!err.empty())
+        return err;
+
+    out << "<?xml version=\"1.0\"?>\n";
+    out << "<analyzerinfo hash=\"" << hash << "\">\n";
+    for (const EntryView &e : entries) {
+        if (e.kind == 'E') {
+            ErrorMessage msg;
+            try {
+                msg.deserialize(std::string(e.data, e.dataSize));
+            } catch (const InternalError &) {
+                return "invalid error message";
+            }
+            out << msg.toXML() << '\n';
+        }
+        else if (e.kind == 'F') {
+            out.write(e.data, e.dataSize);
+        }
+        else if (e.kind == 'D') {
+            out << "  <dependency file=\"" << ErrorLogger::toxml(std::string(e.name, e.nameSize)) << "\"/>\n";
+        }
+    }
+    out << "</analyzerinfo>\n";
+    return "";
 }
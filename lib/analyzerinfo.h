@@ -26,14 +26,16 @@
 #include <cstddef>
 #include <fstream>
 #include <functional>
+#include <iosfwd>
 #include <list>
+#include <map>
 #include <string>
+#include <vector>
 
 class ErrorMessage;
 struct FileSettings;
 
 namespace tinyxml2 {
-    class XMLDocument;
     class XMLElement;
 }
 
@@ -50,11 +52,20 @@ namespace tinyxml2 {
  *
  * The information can be used for various purposes. It allows:
  * - 'make' - only analyze TUs that are changed and generate full report
- * - should be possible to add distributed analysis later
+ * - sharing results between build dirs (--cache-dir)
+ * - distributed analysis - the workers send it back to the coordinator (--coordinator / --worker)
  * - multi-threaded whole program analysis
+ *
+ * The information is stored in a binary file: a header with the checksum, an
+ * index of the entries and the entries themselves (serialized error messages
+ * and the whole program analysis data of the checks). The file is memory-mapped
+ * when it is read so only the entries which are needed are loaded. It can be
+ * exported as XML for debugging.
  */
 class CPPCHECKLIB AnalyzerInformation {
 public:
+    /** @param cacheDir directory with results shared between build dirs (optional) */
+    explicit AnalyzerInformation(std::string cacheDir = "");
     ~AnalyzerInformation();
 
     static void writeFilesTxt(const std::string &buildDir, const std::list<std::string> &sourcefiles, const std::list<FileSettings> &fileSettings);
@@ -67,8 +78,25 @@ public:
     bool analyzeFile(const std::string &buildDir, const std::string &sourcefile, const std::string &cfg, std::size_t fsFileId, std::size_t hash, std::list<ErrorMessage> &errors, bool debug = false);
     void reportErr(const ErrorMessage &msg);
     void setFileInfo(const std::string &check, const std::string &fileInfo);
+
+    /**
+     * Record the size and modification time of the files the TU consists of, so it can be
+     * skipped without preprocessing it when none of them has changed. Nothing is recorded
+     * if one of the files cannot be accessed.
+     * @param optionsHash hash of the options which affect the result
+     */
+    void setDependencies(std::size_t optionsHash, const std::vector<std::string> &files);
+
+    /**
+     * Check if the files recorded by setDependencies() are unchanged and load the findings if they are.
+     * @return true if the analysis of the file can be skipped
+     */
+    static bool skipUnchanged(const std::string &buildDir, const std::string &sourcefile, const std::string &cfg, std::size_t fsFileId, std::size_t optionsHash, std::list<ErrorMessage> &errors, bool debug = false);
     static std::string getAnalyzerInfoFile(const std::string &buildDir, const std::string &sourcefile, const std::string &cfg, std::size_t fsFileId);
 
+    /** Get the file in the cache dir. It only depends on the hash, the file name and the configuration but not on the build dir. */
+    static std::string getCacheFile(const std::string &cacheDir, const std::string &sourcefile, const std::string &cfg, std::size_t hash);
+
     void reopen(const std::string &buildDir, const std::string &sourcefile, const std::string &cfg, std::size_t fsFileId);
 
     static const char sep = ':';
@@ -82,17 +110,63 @@ public:
         std::string sourceFile;
     };
 
-    static std::string processFilesTxt(const std::string& buildDir, const std::function<void(const char* checkattr, const tinyxml2::XMLElement* e, const Info& filesTxtInfo)>& handler, bool debug = false);
+    /**
+     * Pass the whole program analysis data of all files in files.txt to the handler
+     * @param check only pass the data of this check (all checks if empty) - the data of other checks is not loaded
+     * @return error message, empty on success
+     */
+    static std::string processFilesTxt(const std::string& buildDir, const std::function<void(const char* checkattr, const tinyxml2::XMLElement* e, const Info& filesTxtInfo)>& handler, bool debug = false, const std::string& check = "");
+
+    /**
+     * Write the XML form of an analyzer information file (for debugging)
+     * @return error message, empty on success
+     */
+    static std::string exportXml(const std::string &analyzerInfoFile, std::ostream &out);
+
+    /** Wall time (in milliseconds) it took to analyze a file, keyed by the file (and configuration) name */
+    using Timings = std::map<std::string, std::size_t>;
+
+    /** Read timings.txt from the build dir. Returns an empty list if it does not exist. */
+    static Timings readTimingsTxt(const std::string &buildDir);
+    static void writeTimingsTxt(const std::string &buildDir, const Timings &timings);
+
+    /** Peak memory usage (in KiB) of the process analyzing a file, keyed like the timings */
+    using PeakMemory = std::map<std::string, std::size_t>;
+
+    /** Read peakmemory.txt from the build dir. Returns an empty list if it does not exist. */
+    static PeakMemory readPeakMemoryTxt(const std::string &buildDir);
+    static void writePeakMemoryTxt(const std::string &buildDir, const PeakMemory &peakMemory);
 
 protected:
     static std::string getFilesTxt(const std::list<std::string> &sourcefiles, const std::list<FileSettings> &fileSettings);
 
+    static Timings parseTimingsTxt(std::istream& timingsTxt);
+    static std::string getTimingsTxt(const Timings &timings);
+
     static std::string getAnalyzerInfoFileFromFilesTxt(std::istream& filesTxt, const std::string &sourcefile, const std::string &cfg, size_t fsFileId);
 
-    static std::string skipAnalysis(const tinyxml2::XMLDocument &analyzerInfoDoc, std::size_t hash, std::list<ErrorMessage> &errors);
+    /** Entry of an analyzer information file */
+    struct Entry {
+        /** 'E' - error message, 'F' - whole program analysis data, 'O' - options hash, 'D' - dependency */
+        char kind;
+        /** error id, check name or file name */
+        std::string name;
+        /** serialized error message, FileInfo XML element, hash or file size and modification time */
+        std::string data;
+    };
+
+    static std::string serialize(std::size_t hash, const std::vector<Entry> &entries);
+
+    static std::string skipAnalysis(const char *data, std::size_t size, std::size_t hash, std::list<ErrorMessage> &errors);
 
 private:
     std::ofstream mOutputStream;
+    std::string mAnalyzerInfoFile;
+    const std::string mCacheDir;
+    std::string mCacheFile;
+    std::size_t mHash{};
+    std::vector<Entry> mEntries;
+    bool mDebug{};
 };
 
 /// @}
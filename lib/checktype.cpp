@@ -484,7 +484,7 @@ void CheckTypeImpl::checkFloatToIntegerOverflow()
     }
 }
 
-void CheckTypeImpl::checkFloatToIntegerOverflow(const Token *tok, const ValueType *vtint, const ValueType *vtfloat, const std::list<ValueFlow::Value> &floatValues)
+void CheckTypeImpl::checkFloatToIntegerOverflow(const Token *tok, const ValueType *vtint, const ValueType *vtfloat, const ValueFlow::ValueList &floatValues)
 {
     // Conversion of float to integer?
     if (!vtint || !vtint->isIntegral())
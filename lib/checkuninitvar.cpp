@@ -1582,7 +1582,7 @@ void CheckUninitVarImpl::uninitvarError(const Token* tok, const ValueFlow::Value
     errorPath.emplace_back(tok, "");
     auto severity = v.isKnown() ? Severity::error : Severity::warning;
     auto certainty = v.isInconclusive() ? Certainty::inconclusive : Certainty::normal;
-    if (v.subexpressions.empty()) {
+    if (!v.subexpressions) {
         reportError(std::move(errorPath),
                     severity,
                     "uninitvar",
@@ -1591,9 +1591,9 @@ void CheckUninitVarImpl::uninitvarError(const Token* tok, const ValueFlow::Value
                     certainty);
         return;
     }
-    std::string vars = v.subexpressions.size() == 1 ? "variable: " : "variables: ";
+    std::string vars = v.subexpressions->size() == 1 ? "variable: " : "variables: ";
     std::string prefix;
-    for (const std::string& var : v.subexpressions) {
+    for (const std::string& var : *v.subexpressions) {
         vars += prefix + varname + "." + var;
         prefix = ", ";
     }
@@ -1674,7 +1674,7 @@ void CheckUninitVarImpl::valueFlowUninit()
                 const ExprUsage usage = getExprUsage(tok, v->indirect, mSettings);
                 if (usage == ExprUsage::NotUsed || usage == ExprUsage::Inconclusive)
                     continue;
-                if (!v->subexpressions.empty() && usage == ExprUsage::PassedByReference)
+                if (v->subexpressions && usage == ExprUsage::PassedByReference)
                     continue;
                 if (usage != ExprUsage::Used) {
                     if (!(Token::Match(tok->astParent(), ". %name% (|[") && uninitderef) &&
@@ -485,7 +485,7 @@ void CheckUnusedFunctions::analyseWholeProgram(const Settings &settings, ErrorLo
         }
     };
 
-    const std::string err = AnalyzerInformation::processFilesTxt(buildDir, handler, settings.debugainfo);
+    const std::string err = AnalyzerInformation::processFilesTxt(buildDir, handler, settings.debugainfo, "CheckUnusedFunctions");
     if (!err.empty()) {
         const ErrorMessage errmsg({}, "", Severity::error, err, "internalError", Certainty::normal);
         errorLogger.reportErr(errmsg);
@@ -376,7 +376,7 @@ namespace clangimport {
         const ::Type *addTypeTokens(TokenList &tokenList, const std::string &str, const Scope *scope = nullptr);
         void addFullScopeNameTokens(TokenList &tokenList, const Scope *recordScope);
         Scope *createScope(TokenList &tokenList, ScopeType scopeType, AstNodePtr astNode, const Token *def);
-        Scope *createScope(TokenList &tokenList, ScopeType scopeType, const std::vector<AstNodePtr> &children2, const Token *def);
+        Scope *createScope(TokenList &tokenList, ScopeType scopeType, const std::vector<AstNodePtr> &children2, const Token *def, std::string className = "");
         RET_NONNULL Token *createTokensCall(TokenList &tokenList);
         void createTokensFunctionDecl(TokenList &tokenList);
         void createTokensForCXXRecord(TokenList &tokenList);
@@ -706,7 +706,7 @@ Scope *clangimport::AstNode::createScope(TokenList &tokenList, ScopeType scopeTy
     return createScope(tokenList, scopeType, children2, def);
 }
 
-Scope *clangimport::AstNode::createScope(TokenList &tokenList, ScopeType scopeType, const std::vector<AstNodePtr> & children2, const Token *def)
+Scope *clangimport::AstNode::createScope(TokenList &tokenList, ScopeType scopeType, const std::vector<AstNodePtr> & children2, const Token *def, std::string className)
 {
     SymbolDatabase &symbolDatabase = mData->mSymbolDatabase;
 
@@ -714,6 +714,8 @@ Scope *clangimport::AstNode::createScope(TokenList &tokenList, ScopeType scopeTy
 
     symbolDatabase.scopeList.emplace_back(nestedIn->symdb, nullptr, nestedIn);
     Scope *scope = &symbolDatabase.scopeList.back();
+    // the nested scopes are indexed by their name
+    scope->className = std::move(className);
     if (scopeType == ScopeType::eEnum)
         scope->enumeratorList.reserve(children2.size());
     nestedIn->nestedList.push_back(scope);
@@ -1064,9 +1066,7 @@ Token *clangimport::AstNode::createTokens(TokenList &tokenList)
                 addTypeTokens(tokenList, mExtTokens.back());
             }
         }
-        Scope *enumscope = createScope(tokenList, ScopeType::eEnum, children, enumtok);
-        if (nametok)
-            enumscope->className = nametok->str();
+        Scope *enumscope = createScope(tokenList, ScopeType::eEnum, children, enumtok, nametok ? nametok->str() : "");
         if (enumscope->bodyEnd && Token::simpleMatch(enumscope->bodyEnd->previous(), ", }"))
             const_cast<Token *>(enumscope->bodyEnd)->deletePrevious();
 
@@ -1212,9 +1212,7 @@ Token *clangimport::AstNode::createTokens(TokenList &tokenList)
         const std::string &s = mExtTokens[mExtTokens.size() - 2];
         const Token* nameToken = (startsWith(s, "col:") || startsWith(s, "line:")) ?
                                  addtoken(tokenList, mExtTokens.back()) : nullptr;
-        Scope *scope = createScope(tokenList, ScopeType::eNamespace, children, defToken);
-        if (nameToken)
-            scope->className = nameToken->str();
+        createScope(tokenList, ScopeType::eNamespace, children, defToken, nameToken ? nameToken->str() : "");
         return nullptr;
     }
     if (nodeType == NullStmt)
@@ -1237,13 +1235,11 @@ Token *clangimport::AstNode::createTokens(TokenList &tokenList)
             return nullptr;
         }
 
-        Scope *recordScope = createScope(tokenList, ScopeType::eStruct, children, classDef);
+        Scope *recordScope = createScope(tokenList, ScopeType::eStruct, children, classDef, recordName);
         mData->mSymbolDatabase.typeList.emplace_back(classDef, recordScope, classDef->scope());
         recordScope->definedType = &mData->mSymbolDatabase.typeList.back();
-        if (!recordName.empty()) {
-            recordScope->className = recordName;
+        if (!recordName.empty())
             const_cast<Scope *>(classDef->scope())->definedTypesMap[recordName] = recordScope->definedType;
-        }
 
         return nullptr;
     }
@@ -1516,10 +1512,9 @@ void clangimport::AstNode::createTokensForCXXRecord(TokenList &tokenList)
                    child->nodeType == AccessSpecDecl ||
                    child->nodeType == TypedefDecl;
         });
-        Scope *scope = createScope(tokenList, isStruct ? ScopeType::eStruct : ScopeType::eClass, children2, classToken);
+        Scope *scope = createScope(tokenList, isStruct ? ScopeType::eStruct : ScopeType::eClass, children2, classToken, className);
         const std::string addr = mExtTokens[0];
         mData->scopeDecl(addr, scope);
-        scope->className = className;
         mData->mSymbolDatabase.typeList.emplace_back(classToken, scope, classToken->scope());
         scope->definedType = &mData->mSymbolDatabase.typeList.back();
         const_cast<Scope *>(classToken->scope())->definedTypesMap[className] = scope->definedType;
@@ -1682,6 +1677,7 @@ void clangimport::parseClangAstDump(Tokenizer &tokenizer, std::istream &f)
         tokenList.front()->assignIndexes();
     symbolDatabase->clangSetVariables(data.getVariableList());
     symbolDatabase->createSymbolDatabaseExprIds();
+    symbolDatabase->indexNestedScopes();
     tokenList.clangSetOrigFiles();
     setTypes(tokenList);
     setValues(tokenizer, symbolDatabase);
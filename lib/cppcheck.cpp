@@ -30,6 +30,7 @@
 #include "errortypes.h"
 #include "filesettings.h"
 #include "library.h"
+#include "mappedfile.h"
 #include "path.h"
 #include "platform.h"
 #include "preprocessor.h"
@@ -51,7 +52,9 @@
 #endif
 
 #include <algorithm>
+#include <atomic>
 #include <cassert>
+#include <condition_variable>
 #include <cstdio>
 #include <cstdint>
 #include <cstring>
@@ -59,10 +62,13 @@
 #include <cstdlib>
 #include <ctime>
 #include <exception> // IWYU pragma: keep
+#include <future>
 #include <fstream>
+#include <functional>
 #include <iostream>
 #include <iterator>
 #include <map>
+#include <mutex>
 #include <new>
 #include <set>
 #include <sstream>
@@ -106,13 +112,28 @@ public:
         mRemarkComments.insert(mRemarkComments.end(), remarkComments.begin(), remarkComments.end());
     }
 
-    void setLocationMacros(const Token* startTok, const std::vector<std::string>& files)
+    using Location = std::pair<std::string, int>;
+    using LocationMacros = std::map<Location, std::set<std::string>>;
+
+    /** What macros are used on a location? */
+    static LocationMacros getLocationMacros(const Token* startTok, const std::vector<std::string>& files)
     {
-        mLocationMacros.clear();
+        LocationMacros locationMacros;
         for (const Token* tok = startTok; tok; tok = tok->next()) {
             if (!tok->getMacroName().empty())
-                mLocationMacros[Location(files[tok->fileIndex()], tok->linenr())].emplace(tok->getMacroName());
+                locationMacros[Location(files[tok->fileIndex()], tok->linenr())].emplace(tok->getMacroName());
         }
+        return locationMacros;
+    }
+
+    void setLocationMacros(const Token* startTok, const std::vector<std::string>& files)
+    {
+        mLocationMacros = getLocationMacros(startTok, files);
+    }
+
+    void setLocationMacros(LocationMacros locationMacros)
+    {
+        mLocationMacros = std::move(locationMacros);
     }
 
     void resetExitCode()
@@ -287,8 +308,7 @@ private:
 
     std::vector<RemarkComment> mRemarkComments;
 
-    using Location = std::pair<std::string, int>;
-    std::map<Location, std::set<std::string>> mLocationMacros; // What macros are used on a location?
+    LocationMacros mLocationMacros; // What macros are used on a location?
 
     std::ofstream mPlistFile;
     std::vector<std::string> mPlistFilenames;
@@ -299,6 +319,71 @@ private:
 };
 
 
+namespace {
+    /**
+     * @brief Buffers everything which is reported so it can be forwarded in a deterministic order
+     * when the reporting is done by several threads.
+     */
+    class BufferedErrorLogger : public ErrorLogger
+    {
+    public:
+        void reportOut(const std::string &outmsg, Color c) override
+        {
+            mReports.emplace_back([outmsg, c](ErrorLogger &errorLogger) {
+                errorLogger.reportOut(outmsg, c);
+            });
+        }
+
+        void reportErr(const ErrorMessage &msg) override
+        {
+            mReports.emplace_back([msg](ErrorLogger &errorLogger) {
+                errorLogger.reportErr(msg);
+            });
+        }
+
+        void reportMetric(const std::string &metric) override
+        {
+            mReports.emplace_back([metric](ErrorLogger &errorLogger) {
+                errorLogger.reportMetric(metric);
+            });
+        }
+
+        /** forward everything which has been reported so far */
+        void flush(ErrorLogger &errorLogger)
+        {
+            for (const auto &report : mReports)
+                report(errorLogger);
+            mReports.clear();
+        }
+
+    private:
+        std::vector<std::function<void(ErrorLogger&)>> mReports;
+    };
+}
+
+/** @brief A preprocessed configuration which is tokenized, simplified and checked on a separate thread (--config-jobs) */
+struct CppCheck::ConfigJob
+{
+    ConfigJob(std::string currentConfig, simplecpp::TokenList tokens)
+        : currentConfig(std::move(currentConfig))
+        , tokens(std::move(tokens))
+    {}
+
+    std::string currentConfig;
+    simplecpp::TokenList tokens;
+    bool showConfig{};
+    std::string preprocessorDump;
+    std::size_t tokensHash{};
+
+    // results which are applied in the order of the configurations
+    CppCheckLogger::LocationMacros locationMacros;
+    BufferedErrorLogger errorLogger;
+    std::string dump;
+    bool purged{};
+    std::vector<std::function<void()>> deferred;
+    std::exception_ptr exception;
+};
+
 // File deleter
 namespace {
     class FilesDeleter {
@@ -347,6 +432,28 @@ static std::vector<std::string> split(const std::string &str, const std::string
     return ret;
 }
 
+/**
+ * Hash of the preprocessed tokens of a configuration and their locations. The simplification of equal
+ * tokens has an equal result so it only needs to be done for the first configuration with these tokens.
+ */
+static std::size_t calculateTokensHash(const simplecpp::TokenList &tokens)
+{
+    std::string hashData;
+    for (const simplecpp::Token *tok = tokens.cfront(); tok; tok = tok->next) {
+        hashData += std::to_string(tok->location.fileIndex);
+        hashData += ':';
+        hashData += std::to_string(tok->location.line);
+        hashData += ':';
+        hashData += std::to_string(tok->location.col);
+        hashData += ' ';
+        hashData += tok->str();
+        hashData += ' ';
+        hashData += tok->macro;
+        hashData += '\n';
+    }
+    return std::hash<std::string>{}(hashData);
+}
+
 static std::string getDumpFileName(const Settings& settings, const FileWithDetails& file)
 {
     std::string extension = ".dump";
@@ -758,7 +865,7 @@ unsigned int CppCheck::checkClang(const FileWithDetails &file)
                              mSettings,
                              mTimerResults);
         tokenizer.printDebugOutput(std::cout);
-        checkNormalTokens(tokenizer, nullptr, ""); // TODO: provide analyzer information
+        checkNormalTokens(tokenizer, mErrorLogger, nullptr, ""); // TODO: provide analyzer information
 
         // create dumpfile
         std::ofstream fdump;
@@ -868,7 +975,7 @@ unsigned int CppCheck::check(const FileSettings &fs)
     return returnValue;
 }
 
-std::size_t CppCheck::calculateHash(const Preprocessor& preprocessor, const std::string& filePath) const
+std::string CppCheck::getToolInfo(const std::string& filePath) const
 {
     std::ostringstream toolinfo;
     toolinfo << (mSettings.cppcheckCfgProductName.empty() ? CPPCHECK_VERSION_STRING : mSettings.cppcheckCfgProductName);
@@ -889,7 +996,26 @@ std::size_t CppCheck::calculateHash(const Preprocessor& preprocessor, const std:
     toolinfo << mSettings.premiumArgs;
     // TODO: do we need to add more options?
     mSuppressions.nomsg.dump(toolinfo, filePath);
-    return preprocessor.calculateHash(toolinfo.str());
+    return toolinfo.str();
+}
+
+std::size_t CppCheck::calculateHash(const Preprocessor& preprocessor, const std::string& filePath) const
+{
+    return preprocessor.calculateHash(getToolInfo(filePath));
+}
+
+std::size_t CppCheck::calculateOptionsHash(const std::string& filePath) const
+{
+    // the options which affect the preprocessing are not part of the tool info since the hash covers the preprocessed code
+    std::string options = getToolInfo(filePath);
+    for (const std::string &i : mSettings.includePaths)
+        options += " -I" + i;
+    for (const std::string &u : mSettings.userUndefs)
+        options += " -U" + u;
+    options += mSettings.platform.toString();
+    options += mSettings.standards.getC();
+    options += mSettings.standards.getCPP();
+    return std::hash<std::string>{}(options);
 }
 
 unsigned int CppCheck::checkBuffer(const FileWithDetails &file, const std::string &cfgname, const char* data, std::size_t size)
@@ -903,7 +1029,12 @@ unsigned int CppCheck::checkBuffer(const FileWithDetails &file, const std::strin
 unsigned int CppCheck::checkFile(const FileWithDetails& file, const std::string &cfgname)
 {
     const auto f = [&file](std::vector<std::string>& files, simplecpp::OutputList* outputList) {
-        return simplecpp::TokenList{file.spath(), files, outputList};
+        // the file is lexed directly from the mapped memory - simplecpp reports the error if it can not be read
+        MappedFile mapped;
+        bool notFound = false;
+        if (!mapped.open(file.spath(), notFound))
+            return simplecpp::TokenList{file.spath(), files, outputList};
+        return simplecpp::TokenList{{mapped.data(), mapped.size()}, files, file.spath(), outputList};
     };
     return checkInternal(file, cfgname, f);
 }
@@ -970,7 +1101,7 @@ unsigned int CppCheck::checkInternal(const FileWithDetails& file, const std::str
             // TODO: if an exception occurs in this block it will continue in an unexpected code path
             if (!mSettings.buildDir.empty())
             {
-                analyzerInformation.reset(new AnalyzerInformation);
+                analyzerInformation.reset(new AnalyzerInformation(mSettings.cacheDir));
                 mLogger->setAnalyzerInfo(analyzerInformation.get());
             }
 
@@ -1001,6 +1132,18 @@ unsigned int CppCheck::checkInternal(const FileWithDetails& file, const std::str
             return EXIT_SUCCESS;
         }
 
+        // skip the file without preprocessing it if none of its files has changed
+        if (!mSettings.buildDir.empty()) {
+            std::list<ErrorMessage> errors;
+            if (AnalyzerInformation::skipUnchanged(mSettings.buildDir, file.spath(), cfgname, file.fsFileId(), calculateOptionsHash(file.spath()), errors, mSettings.debugainfo)) {
+                while (!errors.empty()) {
+                    mErrorLogger.reportErr(errors.front());
+                    errors.pop_front();
+                }
+                return mLogger->exitcode();
+            }
+        }
+
         simplecpp::OutputList outputList;
         std::vector<std::string> files;
         simplecpp::TokenList tokens1 = createTokenList(files, &outputList);
@@ -1023,7 +1166,7 @@ unsigned int CppCheck::checkInternal(const FileWithDetails& file, const std::str
         preprocessor.removeComments();
 
         if (!mSettings.buildDir.empty()) {
-            analyzerInformation.reset(new AnalyzerInformation);
+            analyzerInformation.reset(new AnalyzerInformation(mSettings.cacheDir));
             mLogger->setAnalyzerInfo(analyzerInformation.get());
         }
 
@@ -1122,9 +1265,24 @@ unsigned int CppCheck::checkInternal(const FileWithDetails& file, const std::str
         }
 
         std::set<unsigned long long> hashes;
+        // the preprocessed tokens of the configurations which have been simplified
+        std::set<std::size_t> tokensHashes;
+        // the simplification of a configuration is skipped if it has the same tokens as a previous one. with a
+        // dump file the results of the simplification are written for every configuration.
+        const bool skipSameTokens = maxConfigs > 1 && !((mSettings.dump || !mSettings.addons.empty()) && fdump.is_open());
         int checkCount = 0;
         bool hasValidConfig = false;
         std::list<std::string> configurationError;
+
+        // the configurations are preprocessed here and the rest is done on several threads afterwards
+        const bool parallelConfigs = mSettings.configJobs > 1 && configurations.size() > 1 && !mSettings.preprocessOnly
+#ifdef HAVE_RULES
+                                     && mSettings.rules.empty()
+#endif
+        ;
+        std::vector<ConfigJob> configJobs;
+        if (parallelConfigs)
+            configJobs.reserve(configurations.size());
         for (const std::string &currCfg : configurations) {
             // bail out if terminated
             if (Settings::terminated())
@@ -1172,6 +1330,7 @@ unsigned int CppCheck::checkInternal(const FileWithDetails& file, const std::str
             }
 
             TokenList tokenlist{mSettings, file.lang()};
+            std::size_t tokensHash = 0;
 
             {
                 bool skipCfg = false;
@@ -1181,7 +1340,12 @@ unsigned int CppCheck::checkInternal(const FileWithDetails& file, const std::str
                     simplecpp::TokenList tokensP = preprocessor.preprocess(currentConfig, files, outputList_cfg);
                     const simplecpp::Output* o = preprocessor.handleErrors(outputList_cfg);
                     if (!o) {
-                        tokenlist.createTokens(std::move(tokensP));
+                        if (skipSameTokens)
+                            tokensHash = calculateTokensHash(tokensP);
+                        if (parallelConfigs)
+                            configJobs.emplace_back(currentConfig, std::move(tokensP));
+                        else
+                            tokenlist.createTokens(std::move(tokensP));
                     }
                     else {
                         // #error etc during preprocessing
@@ -1200,6 +1364,19 @@ unsigned int CppCheck::checkInternal(const FileWithDetails& file, const std::str
             }
             hasValidConfig = true;
 
+            if (parallelConfigs) {
+                ConfigJob &configJob = configJobs.back();
+                configJob.showConfig = !currentConfig.empty() || checkCount > 1;
+                configJob.tokensHash = tokensHash;
+                if ((mSettings.dump || !mSettings.addons.empty()) && fdump.is_open()) {
+                    // the macro usage is only available for the most recently preprocessed configuration
+                    std::ostringstream oss;
+                    preprocessor.dump(oss);
+                    configJob.preprocessorDump = oss.str();
+                }
+                continue;
+            }
+
             Tokenizer tokenizer(std::move(tokenlist), mErrorLogger);
             try {
                 tokenizer.setTimerResults(mTimerResults);
@@ -1226,10 +1403,20 @@ unsigned int CppCheck::checkInternal(const FileWithDetails& file, const std::str
                 executeRules("raw", tokenizer.list);
 #endif
 
+                // Skip if the same preprocessed tokens have already been simplified
+                if (skipSameTokens && tokensHashes.find(tokensHash) != tokensHashes.end()) {
+                    if (mSettings.debugwarnings)
+                        purgedConfigurationMessage(file.spath(), currentConfig);
+                    continue;
+                }
+
                 // Simplify tokens into normal form, skip rest of iteration if failed
                 if (!tokenizer.simplifyTokens1(currentConfig, file.fsFileId()))
                     continue;
 
+                if (skipSameTokens)
+                    tokensHashes.insert(tokensHash);
+
                 // dump xml if --dump
                 if ((mSettings.dump || !mSettings.addons.empty()) && fdump.is_open()) {
                     fdump << "<dump cfg=\"" << ErrorLogger::toxml(currentConfig) << "\">" << std::endl;
@@ -1260,13 +1447,16 @@ unsigned int CppCheck::checkInternal(const FileWithDetails& file, const std::str
                 }
 
                 // Check normal tokens
-                checkNormalTokens(tokenizer, analyzerInformation.get(), currentConfig);
+                checkNormalTokens(tokenizer, mErrorLogger, analyzerInformation.get(), currentConfig);
             } catch (const InternalError &e) {
                 ErrorMessage errmsg = ErrorMessage::fromInternalError(e, &tokenizer.list, file.spath());
                 mErrorLogger.reportErr(errmsg);
             }
         }
 
+        if (parallelConfigs)
+            checkConfigsParallel(file, configJobs, files, directives, analyzerInformation.get(), fdump);
+
         if (!hasValidConfig && configurations.size() > 1 && mSettings.severity.isEnabled(Severity::information)) {
             std::string msg;
             msg = "This file is not analyzed. No working configuration could be extracted. Use -v for more details.";
@@ -1285,6 +1475,10 @@ unsigned int CppCheck::checkInternal(const FileWithDetails& file, const std::str
             mErrorLogger.reportErr(errmsg);
         }
 
+        // inline suppressions are only available after the files are preprocessed so such files cannot be skipped early
+        if (analyzerInformation && !Settings::terminated() && !mSettings.preprocessOnly && !hasInlineSuppressions(files))
+            analyzerInformation->setDependencies(calculateOptionsHash(file.spath()), files);
+
         // TODO: will not be closed if we encountered an exception
         if (fdump.is_open()) {
             // dump all filenames, raw tokens, suppressions
@@ -1333,6 +1527,16 @@ unsigned int CppCheck::checkInternal(const FileWithDetails& file, const std::str
     return mLogger->exitcode();
 }
 
+bool CppCheck::hasInlineSuppressions(const std::vector<std::string>& files) const
+{
+    if (!mSettings.inlineSuppressions)
+        return false;
+    const std::list<SuppressionList::Suppression> suppressions = mSuppressions.nomsg.getSuppressions();
+    return std::any_of(suppressions.cbegin(), suppressions.cend(), [&files](const SuppressionList::Suppression& s) {
+        return s.isInline && std::find(files.cbegin(), files.cend(), s.fileName) != files.cend();
+    });
+}
+
 // TODO: replace with ErrorMessage::fromInternalError()
 void CppCheck::internalError(const std::string &filename, const std::string &msg)
 {
@@ -1354,9 +1558,9 @@ void CppCheck::internalError(const std::string &filename, const std::string &msg
 // CppCheck - A function that checks a normal token list
 //---------------------------------------------------------------------------
 
-void CppCheck::checkNormalTokens(const Tokenizer &tokenizer, AnalyzerInformation* analyzerInformation, const std::string& currentConfig)
+void CppCheck::checkNormalTokens(const Tokenizer &tokenizer, ErrorLogger &errorLogger, AnalyzerInformation* analyzerInformation, const std::string& currentConfig, std::vector<std::function<void()>>* deferred)
 {
-    const ProgressReporter progressReporter(mErrorLogger, mSettings.reportProgress, tokenizer.list.getSourceFilePath(), "Run checkers");
+    const ProgressReporter progressReporter(errorLogger, mSettings.reportProgress, tokenizer.list.getSourceFilePath(), "Run checkers");
 
     CheckUnusedFunctions unusedFunctionsChecker;
 
@@ -1368,35 +1572,69 @@ void CppCheck::checkNormalTokens(const Tokenizer &tokenizer, AnalyzerInformation
         const std::time_t maxTime = mSettings.checksMaxTime > 0 ? std::time(nullptr) + mSettings.checksMaxTime : 0;
 
         // call all "runChecks" in all registered Check classes
-        for (Check * const c : CheckInstances::get()) {
-            if (Settings::terminated())
-                return;
+        bool completed;
+#ifdef HAS_THREADING_MODEL_THREAD
+        if (mSettings.checkersJobs > 1)
+            completed = runChecksParallel(tokenizer, errorLogger, maxTime);
+        else
+#endif
+        {
+            completed = true;
+            for (Check * const c : CheckInstances::get()) {
+                if (Settings::terminated())
+                    return;
 
-            if (maxTime > 0 && std::time(nullptr) > maxTime) {
-                if (mSettings.debugwarnings) {
-                    ErrorMessage::FileLocation loc(tokenizer.list.getFiles()[0], 0, 0);
-                    ErrorMessage errmsg({std::move(loc)},
-                                        "",
-                                        Severity::debug,
-                                        "Checks maximum time exceeded",
-                                        "checksMaxTime",
-                                        Certainty::normal);
-                    mErrorLogger.reportErr(errmsg);
+                if (maxTime > 0 && std::time(nullptr) > maxTime) {
+                    completed = false;
+                    break;
                 }
-                return;
+
+                Timer::run(c->name() + "::runChecks", mTimerResults, [&]() {
+                    c->runChecks(tokenizer, errorLogger);
+                });
             }
+        }
 
-            Timer::run(c->name() + "::runChecks", mTimerResults, [&]() {
-                c->runChecks(tokenizer, mErrorLogger);
-            });
+        if (Settings::terminated())
+            return;
+
+        if (!completed) {
+            if (mSettings.debugwarnings) {
+                ErrorMessage::FileLocation loc(tokenizer.list.getFiles()[0], 0, 0);
+                ErrorMessage errmsg({std::move(loc)},
+                                    "",
+                                    Severity::debug,
+                                    "Checks maximum time exceeded",
+                                    "checksMaxTime",
+                                    Certainty::normal);
+                errorLogger.reportErr(errmsg);
+            }
+            return;
         }
     }
 
+    // results which are stored in this instance or in the analyzer information are applied
+    // afterwards when requested so the configurations can be checked simultaneously
+    const auto apply = [deferred](std::function<void()> f) {
+        if (deferred)
+            deferred->push_back(std::move(f));
+        else
+            f();
+    };
+
     if (mSettings.checks.isEnabled(Checks::unusedFunction) && !mSettings.buildDir.empty()) {
         unusedFunctionsChecker.parseTokens(tokenizer, mSettings.library);
     }
     if (mUnusedFunctionsCheck && mSettings.useSingleJob() && mSettings.buildDir.empty()) {
-        mUnusedFunctionsCheck->parseTokens(tokenizer, mSettings.library);
+        if (deferred) {
+            std::shared_ptr<CheckUnusedFunctions> unusedFunctionsCheck = std::make_shared<CheckUnusedFunctions>();
+            unusedFunctionsCheck->parseTokens(tokenizer, mSettings.library);
+            apply([this, unusedFunctionsCheck]() {
+                mUnusedFunctionsCheck->updateFunctionData(*unusedFunctionsCheck);
+            });
+        } else {
+            mUnusedFunctionsCheck->parseTokens(tokenizer, mSettings.library);
+        }
     }
 
     if (mSettings.clang) {
@@ -1408,10 +1646,16 @@ void CppCheck::checkNormalTokens(const Tokenizer &tokenizer, AnalyzerInformation
         // Analyse the tokens..
         {
             const CTU::FileInfo * const fi1 = CTU::getFileInfo(tokenizer);
-            if (analyzerInformation)
-                analyzerInformation->setFileInfo("ctu", fi1->toString());
+            if (analyzerInformation) {
+                std::string fileInfo = fi1->toString();
+                apply([analyzerInformation, fileInfo]() {
+                    analyzerInformation->setFileInfo("ctu", fileInfo);
+                });
+            }
             if (mSettings.useSingleJob())
-                mFileInfo.push_back(fi1);
+                apply([this, fi1]() {
+                    mFileInfo.push_back(fi1);
+                });
             else
                 delete fi1;
         }
@@ -1419,10 +1663,16 @@ void CppCheck::checkNormalTokens(const Tokenizer &tokenizer, AnalyzerInformation
         if (!doUnusedFunctionOnly) {
             for (const Check * const c : CheckInstances::get()) {
                 if (const Check::FileInfo * const fi = c->getFileInfo(tokenizer, mSettings, currentConfig)) {
-                    if (analyzerInformation)
-                        analyzerInformation->setFileInfo(c->name(), fi->toString());
+                    if (analyzerInformation) {
+                        std::string fileInfo = fi->toString();
+                        apply([analyzerInformation, c, fileInfo]() {
+                            analyzerInformation->setFileInfo(c->name(), fileInfo);
+                        });
+                    }
                     if (mSettings.useSingleJob())
-                        mFileInfo.push_back(fi);
+                        apply([this, fi]() {
+                            mFileInfo.push_back(fi);
+                        });
                     else
                         delete fi;
                 }
@@ -1431,7 +1681,10 @@ void CppCheck::checkNormalTokens(const Tokenizer &tokenizer, AnalyzerInformation
     }
 
     if (mSettings.checks.isEnabled(Checks::unusedFunction) && analyzerInformation) {
-        analyzerInformation->setFileInfo("CheckUnusedFunctions", unusedFunctionsChecker.analyzerInfo(tokenizer));
+        std::string fileInfo = unusedFunctionsChecker.analyzerInfo(tokenizer);
+        apply([analyzerInformation, fileInfo]() {
+            analyzerInformation->setFileInfo("CheckUnusedFunctions", fileInfo);
+        });
     }
 
 #ifdef HAVE_RULES
@@ -1439,6 +1692,247 @@ void CppCheck::checkNormalTokens(const Tokenizer &tokenizer, AnalyzerInformation
 #endif
 }
 
+#ifdef HAS_THREADING_MODEL_THREAD
+bool CppCheck::runChecksParallel(const Tokenizer &tokenizer, ErrorLogger &errorLogger, std::time_t maxTime)
+{
+    // the checkers only read the tokenizer so they can share it. each checker reports into its own
+    // buffer which are forwarded in the registration order so the output matches the serial execution.
+    const std::vector<Check *> checks(CheckInstances::get().cbegin(), CheckInstances::get().cend());
+    std::vector<BufferedErrorLogger> loggers(checks.size());
+    std::vector<std::exception_ptr> exceptions(checks.size());
+    // index of the next checker to run
+    std::atomic<std::size_t> nextCheck{0};
+    // index of the first checker which should not be run anymore
+    std::atomic<std::size_t> stopCheck{checks.size()};
+
+    const auto stopAt = [&stopCheck](std::size_t i) {
+        std::size_t current = stopCheck;
+        while (i < current && !stopCheck.compare_exchange_weak(current, i)) {}
+    };
+
+    const auto runChecks = [&]() {
+        for (;;) {
+            const std::size_t i = nextCheck++;
+            if (i >= stopCheck)
+                return;
+            if (Settings::terminated() || (maxTime > 0 && std::time(nullptr) > maxTime)) {
+                stopAt(i);
+                return;
+            }
+            try {
+                Timer::run(checks[i]->name() + "::runChecks", mTimerResults, [&]() {
+                    checks[i]->runChecks(tokenizer, loggers[i]);
+                });
+            } catch (...) {
+                exceptions[i] = std::current_exception();
+                stopAt(i + 1);
+                return;
+            }
+        }
+    };
+
+    {
+        const unsigned int threads = std::min<std::size_t>(mSettings.checkersJobs, checks.size());
+        std::vector<std::future<void>> futures;
+        futures.reserve(threads);
+        for (unsigned int t = 1; t < threads; ++t)
+            futures.emplace_back(std::async(std::launch::async, runChecks));
+        runChecks();
+        for (std::future<void> &f : futures)
+            f.get();
+    }
+
+    // a checker after stopCheck might have been run before it was lowered - its results are discarded
+    // like it has not been run with a single thread
+    for (std::size_t i = 0; i < stopCheck; ++i) {
+        loggers[i].flush(errorLogger);
+        if (exceptions[i])
+            std::rethrow_exception(exceptions[i]);
+    }
+    return stopCheck == checks.size();
+}
+#endif
+
+void CppCheck::checkConfigsParallel(const FileWithDetails& file, std::vector<ConfigJob>& configJobs, const std::vector<std::string>& files, const std::list<Directive>& directives, AnalyzerInformation* analyzerInformation, std::ofstream& fdump)
+{
+    const bool dump = (mSettings.dump || !mSettings.addons.empty()) && fdump.is_open();
+    const bool skipDuplicates = mSettings.getMaxConfigs() > 1;
+
+    // index of the next configuration to check
+    std::atomic<std::size_t> nextJob{0};
+    // index of the first configuration which should not be checked anymore
+    std::atomic<std::size_t> stopJob{configJobs.size()};
+
+    const auto stopAt = [&stopJob](std::size_t i) {
+        std::size_t current = stopJob;
+        while (i < current && !stopJob.compare_exchange_weak(current, i)) {}
+    };
+
+    // the hashes are compared in the order of the configurations so the same configurations are skipped
+    // as with a single thread. a configuration needs to wait for all previous ones to be simplified.
+    std::mutex hashesSync;
+    std::condition_variable hashesCond;
+    std::size_t nextHash = 0;
+    std::set<std::size_t> hashes;
+    // the preprocessed tokens of the configurations which have been simplified
+    std::set<std::size_t> tokensHashes;
+
+    // the configurations with the same preprocessed tokens as a previous one. these are only simplified if the
+    // previous configurations with these tokens could not be simplified.
+    std::vector<bool> sameTokens(configJobs.size());
+    if (skipDuplicates && !dump) {
+        std::set<std::size_t> seen;
+        for (std::size_t i = 0; i < configJobs.size(); ++i)
+            sameTokens[i] = !seen.insert(configJobs[i].tokensHash).second;
+    }
+
+    const auto checkConfig = [&](std::size_t i) {
+        ConfigJob &configJob = configJobs[i];
+
+        if (sameTokens[i]) {
+            {
+                std::unique_lock<std::mutex> lock(hashesSync);
+                hashesCond.wait(lock, [&]() {
+                    return nextHash == i;
+                });
+                if (tokensHashes.find(configJob.tokensHash) != tokensHashes.end()) {
+                    configJob.purged = true;
+                    ++nextHash;
+                }
+            }
+            if (configJob.purged) {
+                hashesCond.notify_all();
+                return;
+            }
+        }
+
+        bool simplified = false;
+        std::size_t hash = 0;
+
+        Tokenizer tokenizer(TokenList{mSettings, file.lang()}, configJob.errorLogger);
+        try {
+            if (i < stopJob && !Settings::terminated()) {
+                Timer::run("Tokenizer::createTokens", mTimerResults, [&]() {
+                    tokenizer.list.createTokens(std::move(configJob.tokens));
+                });
+                tokenizer.setTimerResults(mTimerResults);
+                tokenizer.setDirectives(directives);
+
+                configJob.locationMacros = CppCheckLogger::getLocationMacros(tokenizer.tokens(), files);
+
+                if (tokenizer.tokens() && tokenizer.simplifyTokens1(configJob.currentConfig, file.fsFileId())) {
+                    if (dump) {
+                        std::ostringstream oss;
+                        oss << "<dump cfg=\"" << ErrorLogger::toxml(configJob.currentConfig) << "\">" << std::endl;
+                        oss << "  <standards>" << std::endl;
+                        oss << "    <c version=\"" << mSettings.standards.getC() << "\"/>" << std::endl;
+                        oss << "    <cpp version=\"" << mSettings.standards.getCPP() << "\"/>" << std::endl;
+                        oss << "  </standards>" << std::endl;
+                        oss << getLibraryDumpData();
+                        oss << configJob.preprocessorDump;
+                        tokenizer.dump(oss);
+                        oss << "</dump>" << std::endl;
+                        configJob.dump = oss.str();
+                    }
+
+                    if (mSettings.inlineSuppressions) {
+                        // Need to call this even if the hash will skip this configuration
+                        mSuppressions.nomsg.markUnmatchedInlineSuppressionsAsChecked(tokenizer.list);
+                    }
+
+                    if (skipDuplicates)
+                        hash = tokenizer.list.calculateHash();
+                    simplified = true;
+                }
+            }
+        } catch (const InternalError &e) {
+            configJob.errorLogger.reportErr(ErrorMessage::fromInternalError(e, &tokenizer.list, file.spath()));
+        } catch (...) {
+            configJob.exception = std::current_exception();
+            stopAt(i + 1);
+        }
+
+        {
+            std::unique_lock<std::mutex> lock(hashesSync);
+            hashesCond.wait(lock, [&]() {
+                return nextHash == i;
+            });
+            if (simplified && skipDuplicates) {
+                configJob.purged = !hashes.insert(hash).second;
+                tokensHashes.insert(configJob.tokensHash);
+            }
+            ++nextHash;
+        }
+        hashesCond.notify_all();
+
+        if (!simplified || configJob.purged)
+            return;
+
+        try {
+            checkNormalTokens(tokenizer, configJob.errorLogger, analyzerInformation, configJob.currentConfig, &configJob.deferred);
+        } catch (const InternalError &e) {
+            configJob.errorLogger.reportErr(ErrorMessage::fromInternalError(e, &tokenizer.list, file.spath()));
+        } catch (...) {
+            configJob.exception = std::current_exception();
+            stopAt(i + 1);
+        }
+    };
+
+    const auto checkConfigs = [&]() {
+        for (;;) {
+            const std::size_t i = nextJob++;
+            if (i >= configJobs.size())
+                return;
+            checkConfig(i);
+        }
+    };
+
+#ifdef HAS_THREADING_MODEL_THREAD
+    {
+        const unsigned int threads = std::min<std::size_t>(mSettings.configJobs, configJobs.size());
+        std::vector<std::future<void>> futures;
+        futures.reserve(threads);
+        for (unsigned int t = 1; t < threads; ++t)
+            futures.emplace_back(std::async(std::launch::async, checkConfigs));
+        checkConfigs();
+        for (std::future<void> &f : futures)
+            f.get();
+    }
+#else
+    checkConfigs();
+#endif
+
+    for (std::size_t i = 0; i < stopJob; ++i) {
+        if (Settings::terminated())
+            break;
+
+        ConfigJob &configJob = configJobs[i];
+
+        mLogger->setLocationMacros(std::move(configJob.locationMacros));
+
+        // If only errors are printed, print filename after the check
+        if (!mSettings.quiet && configJob.showConfig) {
+            std::string fixedpath = Path::toNativeSeparators(file.spath());
+            mErrorLogger.reportOut("Checking " + fixedpath + ": " + configJob.currentConfig + "...", Color::FgGreen);
+        }
+
+        configJob.errorLogger.flush(mErrorLogger);
+        fdump << configJob.dump;
+
+        if (configJob.purged) {
+            if (mSettings.debugwarnings)
+                purgedConfigurationMessage(file.spath(), configJob.currentConfig);
+            continue;
+        }
+
+        for (const std::function<void()> &f : configJob.deferred)
+            f();
+
+        if (configJob.exception)
+            std::rethrow_exception(configJob.exception);
+    }
+}
+
 //---------------------------------------------------------------------------
 
 #ifdef HAVE_RULES
@@ -25,7 +25,9 @@
 #include "config.h"
 
 #include <cstddef>
+#include <ctime>
 #include <functional>
+#include <iosfwd>
 #include <list>
 #include <memory>
 #include <string>
@@ -44,6 +46,7 @@ class Settings;
 struct Suppressions;
 class Preprocessor;
 class TimerResults;
+struct Directive;
 
 namespace simplecpp {
     class TokenList;
@@ -178,6 +181,18 @@ private:
      */
     std::size_t calculateHash(const Preprocessor &preprocessor, const std::string& filePath = {}) const;
 
+    /**
+     * @brief Calculate hash of the options which affect the result of a file - used to decide if the
+     * file can be skipped without preprocessing it.
+     */
+    std::size_t calculateOptionsHash(const std::string& filePath) const;
+
+    /** @brief The options and suppressions which are part of the hashes */
+    std::string getToolInfo(const std::string& filePath) const;
+
+    /** Are there inline suppressions in any of the given files? */
+    bool hasInlineSuppressions(const std::vector<std::string>& files) const;
+
     /**
      * @brief Check a file
      * @param file the file
@@ -213,9 +228,35 @@ private:
     /**
      * @brief Check normal tokens
      * @param tokenizer tokenizer instance
+     * @param errorLogger the findings are reported to this
+     * @param analyzerInformation the analyzer information
+     * @param deferred if given the results which are not reported are added to this instead of being applied
+     */
+    void checkNormalTokens(const Tokenizer &tokenizer, ErrorLogger &errorLogger, AnalyzerInformation* analyzerInformation, const std::string& currentConfig, std::vector<std::function<void()>>* deferred = nullptr);
+
+#ifdef HAS_THREADING_MODEL_THREAD
+    /**
+     * @brief Run the checkers on several threads (--checkers-jobs)
+     * @param tokenizer tokenizer instance
+     * @param errorLogger the findings are reported to this
+     * @param maxTime the time after which no further checkers are started (0 for no limit)
+     * @return false if not all checkers have been run
+     */
+    bool runChecksParallel(const Tokenizer &tokenizer, ErrorLogger &errorLogger, std::time_t maxTime);
+#endif
+
+    struct ConfigJob;
+
+    /**
+     * @brief Tokenize, simplify and check the preprocessed configurations on several threads (--config-jobs)
+     * @param file the file
+     * @param configJobs the preprocessed configurations
+     * @param files the files used by the preprocessed code
+     * @param directives the preprocessor directives
      * @param analyzerInformation the analyzer information
+     * @param fdump the dump file
      */
-    void checkNormalTokens(const Tokenizer &tokenizer, AnalyzerInformation* analyzerInformation, const std::string& currentConfig);
+    void checkConfigsParallel(const FileWithDetails& file, std::vector<ConfigJob>& configJobs, const std::vector<std::string>& files, const std::list<Directive>& directives, AnalyzerInformation* analyzerInformation, std::ofstream& fdump);
 
     /**
      * Execute addons
@@ -92,9 +92,6 @@ namespace {
             bool isDead() const {
                 return action.isModified() || action.isInconclusive() || isEscape();
             }
-            bool hasGoto() const {
-                return endBlock ? ForwardTraversal::hasGoto(endBlock) : false;
-            }
         };
 
         bool stopUpdates() {
@@ -346,7 +343,9 @@ namespace {
             return result;
         }
 
-        static bool hasGoto(const Token* endBlock) {
+        bool hasGoto(const Token* endBlock) const {
+            if (!endBlock || !tokenList.index().contains("goto"))
+                return false;
             return Token::findsimplematch(endBlock->link(), "goto", endBlock);
         }
 
@@ -819,7 +818,7 @@ namespace {
                                 if (pElse != Progress::Break && !analyzer->lowerToInconclusive())
                                     pElse = Break(Analyzer::Terminate::Bail);
                             }
-                            if (thenBranch.hasGoto() || elseBranch.hasGoto()) {
+                            if (hasGoto(thenBranch.endBlock) || hasGoto(elseBranch.endBlock)) {
                                 return Break(Analyzer::Terminate::Bail);
                             }
                             // Carry the then-fork forward, unless a limit is hit - then only the linear main
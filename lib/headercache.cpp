@@ -0,0 +1,148 @@
+/*
+ * Cppcheck - A tool for static C/C++ code analysis
+ * Copyright (C) 2007-2026 Cppcheck team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "headercache.h"
+
+#include "mappedfile.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <utility>
+
+HeaderCache &HeaderCache::instance()
+{
+    static HeaderCache cache;
+    return cache;
+}
+
+/** FNV-1a - the mapped content is hashed without copying it into a string */
+static std::uint64_t hashContent(const char *data, std::size_t size)
+{
+    std::uint64_t hash = 14695981039346656037ULL;
+    for (std::size_t i = 0; i < size; ++i) {
+        hash ^= static_cast<unsigned char>(data[i]);
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+simplecpp::TokenList HeaderCache::copyTokens(const Entry &entry, std::vector<std::string> &filenames)
+{
+    // the tokens refer to the files of the entry - map them to the files of the translation unit
+    std::vector<unsigned int> fileIndex;
+    fileIndex.reserve(entry.files.size());
+    for (const std::string &file : entry.files) {
+        const auto it = std::find(filenames.cbegin(), filenames.cend(), file);
+        if (it != filenames.cend()) {
+            fileIndex.push_back(std::distance(filenames.cbegin(), it));
+        } else {
+            fileIndex.push_back(filenames.size());
+            filenames.push_back(file);
+        }
+    }
+
+    simplecpp::TokenList tokens(filenames);
+    for (const simplecpp::Token *tok = entry.tokens.cfront(); tok; tok = tok->next) {
+        auto *const copy = new simplecpp::Token(*tok);
+        copy->location.fileIndex = fileIndex[tok->location.fileIndex];
+        tokens.push_back(copy);
+    }
+    return tokens;
+}
+
+simplecpp::TokenList HeaderCache::load(const std::string &path, std::vector<std::string> &filenames, simplecpp::OutputList *outputList)
+{
+    // the file is only mapped while it is lexed - the cached tokens do not refer to it
+    MappedFile file;
+    bool notFound = false;
+    if (!file.open(path, notFound))
+        return simplecpp::TokenList(path, filenames, outputList);
+    const std::uint64_t contentHash = hashContent(file.data(), file.size());
+
+    std::shared_ptr<const Entry> cached;
+    {
+        std::lock_guard<std::mutex> lg(mMutex);
+        const auto it = mEntries.find(path);
+        if (it != mEntries.end() && it->second->contentHash == contentHash)
+            cached = it->second;
+    }
+    // the entries are never modified so they can be copied without holding the lock
+    if (cached)
+        return copyTokens(*cached, filenames);
+
+    simplecpp::OutputList errors;
+    const auto entry = std::make_shared<Entry>(contentHash, file.data(), file.size(), path, &errors);
+    if (!errors.empty()) {
+        // the locations of the errors refer to the files of the entry so lex it again
+        return simplecpp::TokenList({file.data(), file.size()}, filenames, path, outputList);
+    }
+    for (const simplecpp::Token *tok = entry->tokens.cfront(); tok; tok = tok->next)
+        ++entry->tokenCount;
+
+    {
+        std::lock_guard<std::mutex> lg(mMutex);
+        const auto it = mEntries.find(path);
+        if (it != mEntries.end()) {
+            // the file has been modified
+            mTokenCount -= it->second->tokenCount;
+            mEntries.erase(it);
+        }
+        if (mTokenCount + entry->tokenCount <= maxTokens) {
+            mEntries.emplace(path, entry);
+            mTokenCount += entry->tokenCount;
+        }
+    }
+
+    return copyTokens(*entry, filenames);
+}
+
+void HeaderCache::prewarm(const std::string &filename, const std::list<std::string> &includePaths, const std::list<std::string> &includes)
+{
+    std::vector<std::string> files;
+    simplecpp::OutputList outputList;
+    MappedFile file;
+    bool notFound = false;
+    const simplecpp::TokenList rawtokens = file.open(filename, notFound) ?
+                                           simplecpp::TokenList({file.data(), file.size()}, files, filename, &outputList) :
+                                           simplecpp::TokenList(filename, files, &outputList);
+    file.close();
+
+    simplecpp::DUI dui;
+    dui.includePaths = includePaths;
+    dui.includes = includes;
+
+    simplecpp::FileDataCache cache;
+    cache.set_lex_callback([this](const std::string &path, std::vector<std::string> &filenames, simplecpp::OutputList *outputList) {
+        return load(path, filenames, outputList);
+    });
+    simplecpp::load(rawtokens, files, dui, &outputList, std::move(cache));
+}
+
+std::size_t HeaderCache::size() const
+{
+    std::lock_guard<std::mutex> lg(mMutex);
+    return mEntries.size();
+}
+
+void HeaderCache::clear()
+{
+    std::lock_guard<std::mutex> lg(mMutex);
+    mEntries.clear();
+    mTokenCount = 0;
+}
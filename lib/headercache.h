@@ -0,0 +1,101 @@
+/* -*- C++ -*-
+ * Cppcheck - A tool for static C/C++ code analysis
+ * Copyright (C) 2007-2026 Cppcheck team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+//---------------------------------------------------------------------------
+#ifndef headercacheH
+#define headercacheH
+//---------------------------------------------------------------------------
+
+#include "config.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <simplecpp.h>
+
+/// @addtogroup Core
+/// @{
+
+/**
+ * @brief Process-wide cache of the raw token lists of included files.
+ *
+ * Every Preprocessor has its own simplecpp::FileDataCache so without this cache
+ * each translation unit reads and lexes all of its headers again. The entries are
+ * keyed by the path and a hash of the content so a modified file is lexed again.
+ * The cached token lists are never modified - every user gets its own copy which
+ * can be preprocessed as usual.
+ *
+ * Thread-safe. When the cache is filled before forking, the child processes
+ * inherit the entries.
+ */
+class CPPCHECKLIB HeaderCache {
+public:
+    /** the cache will not grow beyond this number of tokens */
+    static constexpr std::size_t maxTokens = 2000000;
+
+    static HeaderCache &instance();
+
+    /**
+     * @brief Get the raw tokens of a file - it is lexed if it is not cached yet.
+     * @param path        the file to load
+     * @param filenames   the files of the translation unit - the locations of the tokens refer to these
+     * @param outputList  receives the errors - files which can not be lexed without errors are not cached
+     */
+    simplecpp::TokenList load(const std::string &path, std::vector<std::string> &filenames, simplecpp::OutputList *outputList);
+
+    /**
+     * @brief Load all files which are (transitively) included by a source file.
+     * This is done before the analysis is distributed to several processes.
+     */
+    void prewarm(const std::string &filename, const std::list<std::string> &includePaths, const std::list<std::string> &includes);
+
+    /** number of cached files */
+    std::size_t size() const;
+
+    void clear();
+
+private:
+    struct Entry {
+        Entry(std::uint64_t contentHash, const char *data, std::size_t size, const std::string &path, simplecpp::OutputList *outputList)
+            : contentHash(contentHash)
+            , tokens({data, size}, files, path, outputList)
+        {}
+
+        std::uint64_t contentHash;
+        std::size_t tokenCount{};
+        /** the files which are referred to by the locations of the tokens */
+        std::vector<std::string> files;
+        simplecpp::TokenList tokens;
+    };
+
+    static simplecpp::TokenList copyTokens(const Entry &entry, std::vector<std::string> &filenames);
+
+    mutable std::mutex mMutex;
+    std::unordered_map<std::string, std::shared_ptr<const Entry>> mEntries;
+    std::size_t mTokenCount{};
+};
+
+/// @}
+//---------------------------------------------------------------------------
+#endif // headercacheH
@@ -22,7 +22,6 @@
 #include "config.h"
 #include "mathlib.h"
 
-#include <list>
 #include <string>
 #include <vector>
 
@@ -32,6 +31,7 @@ template<class T> class ValuePtr;
 namespace ValueFlow
 {
     class Value;
+    class ValueList;
 }
 
 struct InferModel {
@@ -45,21 +45,21 @@ protected:
 
 std::vector<ValueFlow::Value> infer(const ValuePtr<InferModel>& model,
                                     const std::string& op,
-                                    std::list<ValueFlow::Value> lhsValues,
-                                    std::list<ValueFlow::Value> rhsValues);
+                                    ValueFlow::ValueList lhsValues,
+                                    ValueFlow::ValueList rhsValues);
 
 std::vector<ValueFlow::Value> infer(const ValuePtr<InferModel>& model,
                                     const std::string& op,
                                     MathLib::bigint lhs,
-                                    std::list<ValueFlow::Value> rhsValues);
+                                    ValueFlow::ValueList rhsValues);
 
 std::vector<ValueFlow::Value> infer(const ValuePtr<InferModel>& model,
                                     const std::string& op,
-                                    std::list<ValueFlow::Value> lhsValues,
+                                    ValueFlow::ValueList lhsValues,
                                     MathLib::bigint rhs);
 
-CPPCHECKLIB std::vector<MathLib::bigint> getMinValue(const ValuePtr<InferModel>& model, const std::list<ValueFlow::Value>& values);
-std::vector<MathLib::bigint> getMaxValue(const ValuePtr<InferModel>& model, const std::list<ValueFlow::Value>& values);
+CPPCHECKLIB std::vector<MathLib::bigint> getMinValue(const ValuePtr<InferModel>& model, const ValueFlow::ValueList& values);
+std::vector<MathLib::bigint> getMaxValue(const ValuePtr<InferModel>& model, const ValueFlow::ValueList& values);
 
 ValuePtr<InferModel> makeIntegralInferModel();
 
@@ -0,0 +1,86 @@
+/*
+ * Cppcheck - A tool for static C/C++ code analysis
+ * Copyright (C) 2007-2026 Cppcheck team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "mappedfile.h"
+
+#include "path.h"
+
+#include <cerrno>
+#include <fstream>
+#include <sstream>
+
+#include <sys/stat.h>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+bool MappedFile::open(const std::string &filename, bool &notFound)
+{
+    close();
+    notFound = false;
+#ifndef _WIN32
+    const int fd = ::open(filename.c_str(), O_RDONLY);
+    if (fd < 0) {
+        notFound = (errno == ENOENT);
+        return false;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        ::close(fd);
+        return false;
+    }
+    mSize = static_cast<std::size_t>(st.st_size);
+    if (mSize > 0) {
+        void * const p = mmap(nullptr, mSize, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (p != MAP_FAILED) {
+            mData = static_cast<const char *>(p);
+            mMapped = true;
+        }
+    }
+    ::close(fd);
+    if (mMapped || mSize == 0)
+        return true;
+#endif
+    // fall back to reading the whole file
+    std::ifstream fin(filename, std::ios::binary);
+    if (!fin.is_open()) {
+        notFound = !Path::exists(filename);
+        return false;
+    }
+    std::ostringstream oss;
+    oss << fin.rdbuf();
+    mBuffer = oss.str();
+    mData = mBuffer.data();
+    mSize = mBuffer.size();
+    return true;
+}
+
+void MappedFile::close()
+{
+#ifndef _WIN32
+    if (mMapped)
+        munmap(const_cast<char *>(mData), mSize);
+    mMapped = false;
+#endif
+    mBuffer.clear();
+    mData = nullptr;
+    mSize = 0;
+}
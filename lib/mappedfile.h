@@ -0,0 +1,73 @@
+/* -*- C++ -*-
+ * Cppcheck - A tool for static C/C++ code analysis
+ * Copyright (C) 2007-2026 Cppcheck team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+//---------------------------------------------------------------------------
+#ifndef mappedfileH
+#define mappedfileH
+//---------------------------------------------------------------------------
+
+#include "config.h"
+
+#include <cstddef>
+#include <string>
+
+/// @addtogroup Core
+/// @{
+
+/**
+ * @brief Read-only view of a whole file.
+ *
+ * The file is memory-mapped where possible so only the pages which are accessed
+ * are read and nothing is copied. Otherwise the file is read into a buffer.
+ */
+class CPPCHECKLIB MappedFile {
+public:
+    MappedFile() = default;
+    MappedFile(const MappedFile &) = delete;
+    MappedFile &operator=(const MappedFile &) = delete;
+
+    ~MappedFile() {
+        close();
+    }
+
+    /**
+     * @param[out] notFound set if the file does not exist
+     * @return false if the file could not be read
+     */
+    bool open(const std::string &filename, bool &notFound);
+
+    void close();
+
+    const char *data() const {
+        return mData;
+    }
+
+    std::size_t size() const {
+        return mSize;
+    }
+
+private:
+    const char *mData{};
+    std::size_t mSize{};
+    bool mMapped{};
+    std::string mBuffer;
+};
+
+/// @}
+//---------------------------------------------------------------------------
+#endif // mappedfileH
@@ -21,6 +21,7 @@
 
 #include "errorlogger.h"
 #include "errortypes.h"
+#include "headercache.h"
 #include "library.h"
 #include "mathlib.h"
 #include "path.h"
@@ -68,6 +69,11 @@ Preprocessor::Preprocessor(simplecpp::TokenList& tokens, const Settings& setting
     , mLang(lang)
 {
     assert(mLang != Standards::Language::None);
+
+    // the included files are lexed only once per process
+    mFileCache.set_lex_callback([](const std::string &path, std::vector<std::string> &filenames, simplecpp::OutputList *outputList) {
+        return HeaderCache::instance().load(path, filenames, outputList);
+    });
 }
 
 namespace {
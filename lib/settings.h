@@ -151,6 +151,9 @@ public:
     /** @brief --cppcheck-build-dir. Always uses / as path separator. No trailing path separator. */
     std::string buildDir;
 
+    /** @brief --cache-dir. Results shared by all build dirs, keyed by the file hash. Always uses / as path separator. No trailing path separator. */
+    std::string cacheDir;
+
     /** Is the 'configuration checking' wanted? */
     bool checkConfiguration{};
 
@@ -165,6 +168,9 @@ public:
     /** @brief The maximum time in seconds for the checks of a single file */
     int checksMaxTime{};
 
+    /** @brief --checkers-jobs=<n> : How many threads should run the checkers of a single file */
+    unsigned int checkersJobs = 1;
+
     /** @brief --checkers-report=<filename> : Generate report of executed checkers */
     std::string checkersReportFilename;
 
@@ -192,6 +198,14 @@ public:
     /** @brief include paths excluded from checking the configuration */
     std::set<std::string> configExcludePaths;
 
+    /** @brief --config-jobs=<n> : How many threads should check the configurations of a single file */
+    unsigned int configJobs = 1;
+
+#ifdef HAS_THREADING_MODEL_FORK
+    /** @brief --coordinator=<address> : hand out the files to the workers connecting on this address */
+    std::string coordinator;
+#endif
+
     /** cppcheck.cfg: Custom product name */
     std::string cppcheckCfgProductName;
 
@@ -271,7 +285,8 @@ public:
         Thread,
 #endif
 #ifdef HAS_THREADING_MODEL_FORK
-        Process
+        Process,
+        ProcessPool
 #endif
     };
 
@@ -314,6 +329,11 @@ public:
 
     std::string manualUrl{"https://cppcheck.sourceforge.io/manual.pdf"};
 
+#ifdef HAS_THREADING_MODEL_FORK
+    /** @brief --max-memory value (in MiB) */
+    unsigned int maxMemory{};
+#endif
+
     /** --max-configs value */
     int maxConfigsOption = 0; // "Not Assigned" value
 
@@ -537,6 +557,11 @@ public:
     /** @brief Is --verbose given? */
     bool verbose{};
 
+#ifdef HAS_THREADING_MODEL_FORK
+    /** @brief --worker=<address> : check the files handed out by the coordinator on this address */
+    std::string worker;
+#endif
+
     /** @brief XML version (--xml-version=..) */
     int xml_version = 2; // TODO: integrate into outputFormat enum?
 
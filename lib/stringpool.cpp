@@ -0,0 +1,67 @@
+/*
+ * Cppcheck - A tool for static C/C++ code analysis
+ * Copyright (C) 2007-2026 Cppcheck team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "stringpool.h"
+
+#include "keywords.h"
+#include "standards.h"
+
+#include <mutex>
+
+static const std::unordered_set<std::string> &getPredefined()
+{
+    static const std::unordered_set<std::string> predefined = [] {
+        std::unordered_set<std::string> strings = {
+            "(", ")", "{", "}", "[", "]", ";", ",", ".", ":", "::", "?", "->", ".*", "->*", "...", "#", "##",
+            "=", "+=", "-=", "*=", "/=", "%=", "&=", "|=", "^=", "<<=", ">>=",
+            "+", "-", "*", "/", "%", "&", "|", "^", "~", "!", "<<", ">>", "++", "--", "&&", "||",
+            "==", "!=", "<", "<=", ">", ">=", "<=>",
+            "std", "size_t", "NULL", "main"
+        };
+        const std::unordered_set<std::string> &c = Keywords::getAll(Standards::CLatest);
+        strings.insert(c.cbegin(), c.cend());
+        const std::unordered_set<std::string> &cpp = Keywords::getAll(Standards::CPPLatest);
+        strings.insert(cpp.cbegin(), cpp.cend());
+        return strings;
+    }();
+    return predefined;
+}
+
+const std::string *StringPool::predefined(const std::string &s)
+{
+    const std::unordered_set<std::string> &strings = getPredefined();
+    const auto it = strings.find(s);
+    return it != strings.cend() ? &*it : nullptr;
+}
+
+const std::string *StringPool::intern(const std::string &s)
+{
+    if (const std::string *p = predefined(s))
+        return p;
+    return &*mStrings.insert(s).first;
+}
+
+const std::string *StringPool::internShared(const std::string &s)
+{
+    if (const std::string *p = predefined(s))
+        return p;
+    static std::mutex mutex;
+    static StringPool pool;
+    std::lock_guard<std::mutex> lg(mutex);
+    return pool.intern(s);
+}
@@ -0,0 +1,70 @@
+/* -*- C++ -*-
+ * Cppcheck - A tool for static C/C++ code analysis
+ * Copyright (C) 2007-2026 Cppcheck team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+//---------------------------------------------------------------------------
+#ifndef stringpoolH
+#define stringpoolH
+//---------------------------------------------------------------------------
+
+#include "config.h"
+
+#include <cstddef>
+#include <string>
+#include <unordered_set>
+
+/// @addtogroup Core
+/// @{
+
+/**
+ * @brief Interned token strings.
+ *
+ * Every distinct string is only stored once and the tokens refer to it. The
+ * keywords and operators are predefined and shared by all pools so two tokens
+ * with the same keyword or operator always refer to the same string - a token
+ * can be compared to one of them by comparing the addresses.
+ *
+ * The strings stay valid as long as the pool exists. Not thread-safe.
+ */
+class CPPCHECKLIB StringPool {
+public:
+    StringPool() = default;
+
+    StringPool(const StringPool &) = delete;
+    StringPool &operator=(const StringPool &) = delete;
+
+    /** @brief Get the interned string */
+    const std::string *intern(const std::string &s);
+
+    /** @brief Get the interned string from a pool which is shared by all threads - the strings are never released */
+    static const std::string *internShared(const std::string &s);
+
+    /** @brief Get the predefined string - nullptr if it is not a keyword or an operator */
+    static const std::string *predefined(const std::string &s);
+
+    /** number of strings which are not predefined */
+    std::size_t size() const {
+        return mStrings.size();
+    }
+
+private:
+    std::unordered_set<std::string> mStrings;
+};
+
+/// @}
+//---------------------------------------------------------------------------
+#endif // stringpoolH
@@ -45,6 +45,7 @@
 #include <iomanip>
 #include <iostream>
 #include <iterator>
+#include <mutex>
 #include <numeric>
 #include <sstream>
 #include <stack>
@@ -56,6 +57,10 @@
 #include <utility>
 //---------------------------------------------------------------------------
 
+#include <cstdio>
+#include <tuple>
+struct FFProf { std::size_t calls=0, noname=0, repeat=0; std::set<std::tuple<const void*,const void*,bool,int,std::string,int>> keys; int gen=0; std::size_t samegen=0, nonull=0, hits=0, version=0; std::map<std::tuple<const void*,const void*,bool,int,std::string>, std::size_t> vkeys; ~FFProf(){ std::fprintf(stderr,"FFPROF calls=%zu noname=%zu repeat=%zu samegen=%zu hits=%zu nonull=%zu\n",calls,noname,repeat,samegen,hits,nonull);} };
+static FFProf ffprof;
 SymbolDatabase::SymbolDatabase(Tokenizer& tokenizer)
     : mTokenizer(tokenizer)
     , mSettings(tokenizer.getSettings())
@@ -91,6 +96,7 @@ SymbolDatabase::SymbolDatabase(Tokenizer& tokenizer)
     createSymbolDatabaseEscapeFunctions();
     createSymbolDatabaseIncompleteVars();
     createSymbolDatabaseExprIds();
+    indexNestedScopes();
     debugSymbolDatabase();
 }
 
@@ -188,14 +194,12 @@ void SymbolDatabase::createSymbolDatabaseFindAllScopes()
             return findForwardDeclScope(tok->next(), &scopeList.front());
 
         if (Token::Match(tok, "%name% :: %name%")) {
-            auto it = std::find_if(startScope->nestedList.cbegin(), startScope->nestedList.cend(), [&](const Scope *scope) {
-                return scope->className == tok->str();
-            });
+            const std::vector<Scope *> &nested = startScope->findInNestedList(tok->str());
 
-            if (it == startScope->nestedList.cend())
+            if (nested.empty())
                 return static_cast<const Scope *>(nullptr);
 
-            return findForwardDeclScope(tok->tokAt(2), *it);
+            return findForwardDeclScope(tok->tokAt(2), nested.front());
         }
 
         auto it = forwardDecls.find(startScope);
@@ -2304,6 +2308,7 @@ bool SymbolDatabase::isFunctionWithoutSideEffects(const Function& func, const To
 
 bool SymbolDatabase::isRecordTypeWithoutSideEffects(const Type* type) const
 {
+    std::lock_guard<std::recursive_mutex> lg(mIsRecordTypeWithoutSideEffectsSync);
     const std::pair<std::map<const Type*, bool>::iterator, bool> found = mIsRecordTypeWithoutSideEffectsMap.insert(
         std::pair<const Type*, bool>(type, false));         //Initialize with side effects for possible recursions
     bool& withoutSideEffects = found.first->second;
@@ -6027,6 +6032,15 @@ static bool hasMatchingConstructor(const Scope* classScope, const ValueType* arg
 const Function* Scope::findFunction(const Token* tok, bool requireConst, Reference ref, const std::string& funcName) const
 {
     const std::string& name = funcName.empty() ? tok->str() : funcName;
+    ffprof.calls++;
+    if (functionMap.find(name) == functionMap.end()) ffprof.noname++;
+    if (!ffprof.keys.emplace(this, tok, requireConst, (int)ref, funcName, -1).second) ffprof.repeat++;
+    if (!ffprof.keys.emplace(this, tok, requireConst, (int)ref, funcName, ffprof.gen).second) ffprof.samegen++;
+    if (functionMap.find(name) != functionMap.end()) { ffprof.nonull++;
+    auto vk = std::make_tuple((const void*)this, (const void*)tok, requireConst, (int)ref, funcName);
+    auto vit = ffprof.vkeys.find(vk);
+    if (vit != ffprof.vkeys.end() && vit->second == ffprof.version) ffprof.hits++;
+    ffprof.vkeys[vk] = ffprof.version; }
 
     const bool isCall = Token::Match(tok->next(), "(|{");
 
@@ -6480,6 +6494,14 @@ const Function* SymbolDatabase::findFunction(const Token* const tok) const
 
 //---------------------------------------------------------------------------
 
+void SymbolDatabase::indexNestedScopes() const
+{
+    for (const Scope &scope : scopeList)
+        scope.indexNestedList();
+}
+
+//---------------------------------------------------------------------------
+
 // cppcheck-suppress unusedFunction
 const Scope *SymbolDatabase::findScopeByName(const std::string& name) const
 {
@@ -6494,14 +6516,19 @@ const Scope *SymbolDatabase::findScopeByName(const std::string& name) const
 template<class S, class T, REQUIRES("S must be a Scope class", std::is_convertible<S*, const Scope*> ), REQUIRES("T must be a Type class", std::is_convertible<T*, const Type*> )>
 static S* findRecordInNestedListImpl(S& thisScope, const std::string& name, bool isC, std::set<const Scope*>& visited)
 {
-    for (S* scope: thisScope.nestedList) {
-        if (scope->className == name && scope->type != ScopeType::eFunction)
-            return scope;
-        if (isC) {
+    if (isC) {
+        for (S* scope: thisScope.nestedList) {
+            if (scope->className == name && scope->type != ScopeType::eFunction)
+                return scope;
             S* nestedScope = scope->findRecordInNestedList(name, isC);
             if (nestedScope)
                 return nestedScope;
         }
+    } else {
+        for (S* scope: thisScope.findInNestedList(name)) {
+            if (scope->type != ScopeType::eFunction)
+                return scope;
+        }
     }
 
     for (const auto& u : thisScope.usingList) {
@@ -6577,13 +6604,29 @@ Type* Scope::findType(const std::string& name)
 
 //---------------------------------------------------------------------------
 
+const std::vector<Scope *> &Scope::findInNestedList(const std::string & name) const
+{
+    static const std::vector<Scope *> empty;
+    indexNestedList();
+    auto it = mNestedListIndex.find(name);
+    return it == mNestedListIndex.end() ? empty : it->second;
+}
+
+void Scope::indexNestedList() const
+{
+    for (; mNestedListIndexed < nestedList.size(); ++mNestedListIndexed) {
+        Scope *scope = nestedList[mNestedListIndexed];
+        mNestedListIndex[scope->className].push_back(scope);
+    }
+}
+
+//---------------------------------------------------------------------------
+
 const Scope *Scope::findInNestedListRecursive(const std::string & name) const
 {
-    auto it = std::find_if(nestedList.cbegin(), nestedList.cend(), [&](const Scope* s) {
-        return s->className == name;
-    });
-    if (it != nestedList.end())
-        return *it;
+    const std::vector<Scope *> &nested = findInNestedList(name);
+    if (!nested.empty())
+        return nested.front();
 
     for (const Scope* scope: nestedList) {
         const Scope *child = scope->findInNestedListRecursive(name);
@@ -6960,6 +7003,7 @@ static bool isContainerYieldPointer(Library::Container::Yield yield)
 
 void SymbolDatabase::setValueType(Token* tok, const ValueType& valuetype, const SourceLocation &loc)
 {
+    ffprof.version++;
     auto* valuetypePtr = new ValueType(valuetype);
     if (mSettings.debugnormal || mSettings.debugwarnings)
         valuetypePtr->setDebugPath(tok, loc);
@@ -7844,6 +7888,7 @@ static int getIntegerConstantMacroWidth(const Token* tok) {
 
 void SymbolDatabase::setValueTypeInTokenList(bool reportDebugWarnings, Token *tokens)
 {
+    ffprof.gen++;
     if (!tokens)
         tokens = mTokenizer.list.front();
 
@@ -36,8 +36,10 @@
 #include <iosfwd>
 #include <list>
 #include <map>
+#include <mutex>
 #include <set>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -1156,6 +1158,16 @@ public:
     const Scope *findRecordInNestedList(const std::string & name, bool isC = false) const;
     Scope *findRecordInNestedList(const std::string & name, bool isC = false);
 
+    /**
+     * @brief find the nested scopes with a name
+     * @param name name of nested scope
+     * @return the nested scopes with this name in the order of the nested list
+     */
+    const std::vector<Scope *> &findInNestedList(const std::string & name) const;
+
+    /** @brief add the scopes which have been added to the nested list since the last lookup to the name index */
+    void indexNestedList() const;
+
     const Type* findType(const std::string& name) const;
     Type* findType(const std::string& name);
 
@@ -1222,6 +1234,10 @@ private:
 
     /** @brief initialize varlist */
     void getVariableList(const Token *start, const Token *end);
+
+    /** nested scopes by their name, the scopes are added on the first lookup after they were nested */
+    mutable std::unordered_map<std::string, std::vector<Scope *>> mNestedListIndex;
+    mutable std::size_t mNestedListIndexed{};
 };
 
 /** Value type */
@@ -1436,6 +1452,9 @@ public:
     void clangSetVariables(const std::vector<const Variable *> &vars);
     void createSymbolDatabaseExprIds();
 
+    /** Index the nested scopes of all scopes so the lookups do not need to update the indexes anymore */
+    void indexNestedScopes() const;
+
     /* returns the opening { if tok points to enum */
     static const Token* isEnumDefinition(const Token* tok);
 
@@ -1523,6 +1542,8 @@ private:
 
     ValueType::Sign mDefaultSignedness;
 
+    /** the checkers might be run in parallel (--checkers-jobs) */
+    mutable std::recursive_mutex mIsRecordTypeWithoutSideEffectsSync;
     mutable std::map<const Type*, bool> mIsRecordTypeWithoutSideEffectsMap;
 };
 
@@ -74,25 +74,23 @@ namespace {
         const Token * const mToken;
     };
 
-    class FindName {
-    public:
-        explicit FindName(std::string name) : mName(std::move(name)) {}
-        bool operator()(const TemplateSimplifier::TokenAndName &tokenAndName) const {
-            return tokenAndName.name() == mName;
-        }
-    private:
-        const std::string mName;
-    };
+    /** The declarations by their full name. The declarations of a name are in the order of the list. */
+    using FullNameIndex = std::unordered_map<std::string, std::vector<TemplateSimplifier::TokenAndName *>>;
+
+    FullNameIndex indexByFullName(std::list<TemplateSimplifier::TokenAndName> &declarations)
+    {
+        FullNameIndex index;
+        for (TemplateSimplifier::TokenAndName &decl : declarations)
+            index[decl.fullName()].push_back(&decl);
+        return index;
+    }
 
-    class FindFullName {
-    public:
-        explicit FindFullName(std::string fullName) : mFullName(std::move(fullName)) {}
-        bool operator()(const TemplateSimplifier::TokenAndName &tokenAndName) const {
-            return tokenAndName.fullName() == mFullName;
-        }
-    private:
-        const std::string mFullName;
-    };
+    const std::vector<TemplateSimplifier::TokenAndName *> &findFullName(const FullNameIndex &index, const std::string &fullName)
+    {
+        static const std::vector<TemplateSimplifier::TokenAndName *> none;
+        const auto it = index.find(fullName);
+        return it == index.cend() ? none : it->second;
+    }
 }
 
 TemplateSimplifier::TokenAndName::TokenAndName(Token *token, std::string scope) :
@@ -718,15 +716,30 @@ void TemplateSimplifier::addInstantiation(Token *token, const std::string &scope
 {
     simplifyTemplateArgs(token->tokAt(2), token->next()->findClosingBracket());
 
-    TokenAndName instantiation(token, scope);
+    const TokenAndName instantiation(token, scope);
 
-    // check if instantiation already exists before adding it
-    const auto it = std::find(mTemplateInstantiations.cbegin(),
-                              mTemplateInstantiations.cend(),
-                              instantiation);
+    // check if instantiation already exists before adding it - an equal instantiation refers to the same token
+    const std::set<TokenAndName*>* pointers = token->templateSimplifierPointers();
+    if (std::none_of(pointers->cbegin(), pointers->cend(), [&](const TokenAndName *p) {
+        return p != &instantiation && mTemplateInstantiationSet.count(p) != 0 && *p == instantiation;
+    }))
+        emplaceInstantiation(token, scope);
+}
+
+void TemplateSimplifier::emplaceInstantiation(Token *token, const std::string &scope)
+{
+    mTemplateInstantiations.emplace_back(token, scope);
+    mTemplateInstantiationSet.insert(&mTemplateInstantiations.back());
+    ++mTemplateInstantiationNames[mTemplateInstantiations.back().name()];
+}
 
-    if (it == mTemplateInstantiations.cend())
-        mTemplateInstantiations.emplace_back(std::move(instantiation));
+std::list<TemplateSimplifier::TokenAndName>::const_iterator TemplateSimplifier::eraseInstantiation(std::list<TokenAndName>::const_iterator it)
+{
+    mTemplateInstantiationSet.erase(&*it);
+    const auto name = mTemplateInstantiationNames.find(it->name());
+    if (--name->second == 0)
+        mTemplateInstantiationNames.erase(name);
+    return mTemplateInstantiations.erase(it);
 }
 
 static const Token* getFunctionToken(const Token* nameToken)
@@ -806,6 +819,8 @@ void TemplateSimplifier::getTemplateInstantiations()
             functionNameMap.emplace(decl.name(), &decl);
     }
 
+    const FullNameIndex declarations = indexByFullName(mTemplateDeclarations);
+
     const Token *skip = nullptr;
 
     for (Token *tok = mTokenList.front(); tok; tok = tok->next()) {
@@ -1000,10 +1015,10 @@ void TemplateSimplifier::getTemplateInstantiations()
                 while (true) {
                     std::string fullName = scopeName + (scopeName.empty()?"":" :: ") +
                                            qualification + (qualification.empty()?"":" :: ") + tok->str();
-                    const auto it = std::find_if(mTemplateDeclarations.cbegin(), mTemplateDeclarations.cend(), FindFullName(std::move(fullName)));
-                    if (it != mTemplateDeclarations.end()) {
+                    const std::vector<TokenAndName *> &decls = findFullName(declarations, fullName);
+                    if (!decls.empty()) {
                         // full name matches
-                        addInstantiation(tok, it->scope());
+                        addInstantiation(tok, decls.front()->scope());
                         break;
                     }
                     // full name doesn't match so try with using namespaces if available
@@ -1012,8 +1027,8 @@ void TemplateSimplifier::getTemplateInstantiations()
                         std::string fullNameSpace = scopeName + (scopeName.empty()?"":" :: ") +
                                                     nameSpace + (qualification.empty()?"":" :: ") + qualification;
                         std::string newFullName = fullNameSpace + " :: " + tok->str();
-                        const auto it1 = std::find_if(mTemplateDeclarations.cbegin(), mTemplateDeclarations.cend(), FindFullName(std::move(newFullName)));
-                        if (it1 != mTemplateDeclarations.end()) {
+                        const std::vector<TokenAndName *> &decls1 = findFullName(declarations, newFullName);
+                        if (!decls1.empty()) {
                             // insert using namespace into token stream
                             std::string::size_type offset = 0;
                             std::string::size_type pos = 0;
@@ -1023,7 +1038,7 @@ void TemplateSimplifier::getTemplateInstantiations()
                             }
                             qualificationTok->insertTokenBefore(nameSpace.substr(offset));
                             qualificationTok->insertTokenBefore("::");
-                            addInstantiation(tok, it1->scope());
+                            addInstantiation(tok, decls1.front()->scope());
                             found = true;
                             break;
                         }
@@ -1260,7 +1275,7 @@ void TemplateSimplifier::useDefaultArgumentValues(TokenAndName &declaration)
                                              mTemplateInstantiations.cend(),
                                              FindToken(tok2));
                 if (ti != mTemplateInstantiations.end())
-                    mTemplateInstantiations.erase(ti);
+                    eraseInstantiation(ti);
                 ++indentlevel;
             } else if (indentlevel > 0 && tok2->str() == ">")
                 --indentlevel;
@@ -1275,11 +1290,7 @@ void TemplateSimplifier::useDefaultArgumentValues(TokenAndName &declaration)
             continue;
 
         // don't strip args from uninstantiated templates
-        const auto ti2 = std::find_if(mTemplateInstantiations.cbegin(),
-                                      mTemplateInstantiations.cend(),
-                                      FindName(declaration.name()));
-
-        if (ti2 == mTemplateInstantiations.end())
+        if (mTemplateInstantiationNames.count(declaration.name()) == 0)
             continue;
 
         eraseTokens(eqtok, tok2);
@@ -1395,7 +1406,7 @@ void TemplateSimplifier::simplifyTemplateAliases()
             found = true;
 
             // erase this instantiation
-            it2 = mTemplateInstantiations.erase(it2);
+            it2 = eraseInstantiation(it2);
         }
 
         if (found) {
@@ -2354,7 +2365,7 @@ void TemplateSimplifier::expandTemplate(
         // only add recursive instantiation if its arguments are a constant expression
         if (templateDeclaration.name() != inst.token->str() ||
             (inst.token->tokAt(2)->isNumber() || inst.token->tokAt(2)->isStandardType()))
-            mTemplateInstantiations.emplace_back(inst.token, inst.scope);
+            emplaceInstantiation(inst.token, inst.scope);
     }
 }
 
@@ -3147,7 +3158,13 @@ bool TemplateSimplifier::simplifyTemplateInstantiations(
 
     bool instantiated = false;
 
+    // only the instantiations with the name of the declaration can match
+    const bool hasInstantiations = mTemplateInstantiationNames.count(templateDeclaration.name()) != 0;
+
     for (const TokenAndName &instantiation : mTemplateInstantiations) {
+        if (!hasInstantiations)
+            break;
+
         // skip deleted instantiations
         if (!instantiation.token())
             continue;
@@ -3472,7 +3489,7 @@ void TemplateSimplifier::replaceTemplateUsage(
             if (tok->isName() && tok->templateSimplifierPointers() && !tok->templateSimplifierPointers()->empty()) {
                 for (auto ti = mTemplateInstantiations.cbegin(); ti != mTemplateInstantiations.cend();) {
                     if (ti->token() == tok) {
-                        mTemplateInstantiations.erase(ti);
+                        eraseInstantiation(ti);
                         break;
                     }
                     ++ti;
@@ -3525,19 +3542,24 @@ static bool specMatch(
 void TemplateSimplifier::getSpecializations()
 {
     // try to locate a matching declaration for each user defined specialization
+    const FullNameIndex declarations = indexByFullName(mTemplateDeclarations);
+    const FullNameIndex forwardDeclarations = indexByFullName(mTemplateForwardDeclarations);
+    const auto match = [](const TokenAndName &spec, const std::vector<TokenAndName *> &decls) {
+        return std::find_if(decls.cbegin(), decls.cend(), [&](const TokenAndName* decl) {
+            return specMatch(spec, *decl);
+        });
+    };
     for (const auto& spec : mTemplateDeclarations) {
         if (spec.isSpecialization()) {
-            auto it = std::find_if(mTemplateDeclarations.cbegin(), mTemplateDeclarations.cend(), [&](const TokenAndName& decl) {
-                return specMatch(spec, decl);
-            });
-            if (it != mTemplateDeclarations.cend())
-                mTemplateSpecializationMap[spec.token()] = it->token();
+            const std::vector<TokenAndName *> &decls = findFullName(declarations, spec.fullName());
+            auto it = match(spec, decls);
+            if (it != decls.cend())
+                mTemplateSpecializationMap[spec.token()] = (*it)->token();
             else {
-                it = std::find_if(mTemplateForwardDeclarations.cbegin(), mTemplateForwardDeclarations.cend(), [&](const TokenAndName& decl) {
-                    return specMatch(spec, decl);
-                });
-                if (it != mTemplateForwardDeclarations.cend())
-                    mTemplateSpecializationMap[spec.token()] = it->token();
+                const std::vector<TokenAndName *> &forwardDecls = findFullName(forwardDeclarations, spec.fullName());
+                it = match(spec, forwardDecls);
+                if (it != forwardDecls.cend())
+                    mTemplateSpecializationMap[spec.token()] = (*it)->token();
             }
         }
     }
@@ -3546,19 +3568,24 @@ void TemplateSimplifier::getSpecializations()
 void TemplateSimplifier::getPartialSpecializations()
 {
     // try to locate a matching declaration for each user defined partial specialization
+    const FullNameIndex declarations = indexByFullName(mTemplateDeclarations);
+    const FullNameIndex forwardDeclarations = indexByFullName(mTemplateForwardDeclarations);
+    const auto match = [](const TokenAndName &spec, const std::vector<TokenAndName *> &decls) {
+        return std::find_if(decls.cbegin(), decls.cend(), [&](const TokenAndName* decl) {
+            return specMatch(spec, *decl);
+        });
+    };
     for (const auto& spec : mTemplateDeclarations) {
         if (spec.isPartialSpecialization()) {
-            auto it = std::find_if(mTemplateDeclarations.cbegin(), mTemplateDeclarations.cend(), [&](const TokenAndName& decl) {
-                return specMatch(spec, decl);
-            });
-            if (it != mTemplateDeclarations.cend())
-                mTemplatePartialSpecializationMap[spec.token()] = it->token();
+            const std::vector<TokenAndName *> &decls = findFullName(declarations, spec.fullName());
+            auto it = match(spec, decls);
+            if (it != decls.cend())
+                mTemplatePartialSpecializationMap[spec.token()] = (*it)->token();
             else {
-                it = std::find_if(mTemplateForwardDeclarations.cbegin(), mTemplateForwardDeclarations.cend(), [&](const TokenAndName& decl) {
-                    return specMatch(spec, decl);
-                });
-                if (it != mTemplateForwardDeclarations.cend())
-                    mTemplatePartialSpecializationMap[spec.token()] = it->token();
+                const std::vector<TokenAndName *> &forwardDecls = findFullName(forwardDeclarations, spec.fullName());
+                it = match(spec, forwardDecls);
+                if (it != forwardDecls.cend())
+                    mTemplatePartialSpecializationMap[spec.token()] = (*it)->token();
             }
         }
     }
@@ -3566,51 +3593,51 @@ void TemplateSimplifier::getPartialSpecializations()
 
 void TemplateSimplifier::fixForwardDeclaredDefaultArgumentValues()
 {
+    const FullNameIndex declarations = indexByFullName(mTemplateDeclarations);
+
     // try to locate a matching declaration for each forward declaration
     for (const auto & forwardDecl : mTemplateForwardDeclarations) {
         std::vector<const Token *> params1;
 
         getTemplateParametersInDeclaration(forwardDecl.token()->tokAt(2), params1);
 
-        for (auto & decl : mTemplateDeclarations) {
+        // the scopes and names must match
+        for (TokenAndName *decl : findFullName(declarations, forwardDecl.fullName())) {
             // skip partializations, type aliases and friends
-            if (decl.isPartialSpecialization() || decl.isAlias() || decl.isFriend())
+            if (decl->isPartialSpecialization() || decl->isAlias() || decl->isFriend())
                 continue;
 
             std::vector<const Token *> params2;
 
-            getTemplateParametersInDeclaration(decl.token()->tokAt(2), params2);
+            getTemplateParametersInDeclaration(decl->token()->tokAt(2), params2);
 
             // make sure the number of arguments match
             if (params1.size() == params2.size()) {
-                // make sure the scopes and names match
-                if (forwardDecl.fullName() == decl.fullName()) {
-                    // save forward declaration for lookup later
-                    if ((decl.nameToken()->strAt(1) == "(" && forwardDecl.nameToken()->strAt(1) == "(") ||
-                        (decl.nameToken()->strAt(1) == "{" && forwardDecl.nameToken()->strAt(1) == ";")) {
-                        mTemplateForwardDeclarationsMap[decl.token()] = forwardDecl.token();
-                    }
+                // save forward declaration for lookup later
+                if ((decl->nameToken()->strAt(1) == "(" && forwardDecl.nameToken()->strAt(1) == "(") ||
+                    (decl->nameToken()->strAt(1) == "{" && forwardDecl.nameToken()->strAt(1) == ";")) {
+                    mTemplateForwardDeclarationsMap[decl->token()] = forwardDecl.token();
+                }
 
-                    for (size_t k = 0; k < params1.size(); k++) {
-                        // copy default value to declaration if not present
-                        if (params1[k]->strAt(1) == "=" && params2[k]->strAt(1) != "=") {
-                            int level = 0;
-                            const Token *end = params1[k]->next();
-                            while (end && !(level == 0 && Token::Match(end, ",|>"))) {
-                                if (Token::Match(end, "{|(|<"))
-                                    level++;
-                                else if (Token::Match(end, "}|)|>"))
-                                    level--;
-                                end = end->next();
-                            }
-                            if (end)
-                                TokenList::copyTokens(const_cast<Token *>(params2[k]), params1[k]->next(), end->previous());
+                for (size_t k = 0; k < params1.size(); k++) {
+                    // copy default value to declaration if not present
+                    if (params1[k]->strAt(1) == "=" && params2[k]->strAt(1) != "=") {
+                        int level = 0;
+                        const Token *end = params1[k]->next();
+                        while (end && !(level == 0 && Token::Match(end, ",|>"))) {
+                            if (Token::Match(end, "{|(|<"))
+                                level++;
+                            else if (Token::Match(end, "}|)|>"))
+                                level--;
+                            end = end->next();
                         }
+                        if (end)
+                            TokenList::copyTokens(const_cast<Token *>(params2[k]), params1[k]->next(), end->previous());
                     }
-
-                    // update parameter end pointer
-                    decl.paramEnd(decl.token()->next()->findClosingBracket());
                 }
+
+                // update parameter end pointer
+                decl->paramEnd(decl->token()->next()->findClosingBracket());
             }
         }
     }
@@ -3870,6 +3897,8 @@ void TemplateSimplifier::simplifyTemplates(const std::time_t maxtime)
             mTemplateSpecializationMap.clear();
             mTemplatePartialSpecializationMap.clear();
             mTemplateInstantiations.clear();
+            mTemplateInstantiationSet.clear();
+            mTemplateInstantiationNames.clear();
             mInstantiatedTemplates.clear();
             mExplicitInstantiationsToDelete.clear();
             mTemplateNamePos.clear();
@@ -3970,18 +3999,19 @@ void TemplateSimplifier::simplifyTemplates(const std::time_t maxtime)
 
         std::set<std::string> expandedtemplates;
 
+        const FullNameIndex declarations = indexByFullName(mTemplateDeclarations);
+
         for (auto iter1 = mTemplateDeclarations.crbegin(); iter1 != mTemplateDeclarations.crend(); ++iter1) {
             if (iter1->isAlias() || iter1->isFriend())
                 continue;
 
             // get specializations..
             std::list<const Token *> specializations;
-            for (auto iter2 = mTemplateDeclarations.cbegin(); iter2 != mTemplateDeclarations.cend(); ++iter2) {
-                if (iter2->isAlias() || iter2->isFriend())
+            for (const TokenAndName *decl : findFullName(declarations, iter1->fullName())) {
+                if (decl->isAlias() || decl->isFriend())
                     continue;
 
-                if (iter1->fullName() == iter2->fullName())
-                    specializations.push_back(iter2->nameToken());
+                specializations.push_back(decl->nameToken());
             }
 
             const bool instantiated = simplifyTemplateInstantiations(
@@ -31,6 +31,7 @@
 #include <set>
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 class ErrorLogger;
@@ -353,6 +354,12 @@ private:
      */
     void addInstantiation(Token *token, const std::string &scope);
 
+    /** Append an instantiation to mTemplateInstantiations and index it. */
+    void emplaceInstantiation(Token *token, const std::string &scope);
+
+    /** Erase an instantiation from mTemplateInstantiations and its indexes. */
+    std::list<TokenAndName>::const_iterator eraseInstantiation(std::list<TokenAndName>::const_iterator it);
+
     /**
      * Get template instantiations
      */
@@ -516,6 +523,10 @@ private:
     std::map<const Token *, Token *> mTemplateSpecializationMap;
     std::map<const Token *, Token *> mTemplatePartialSpecializationMap;
     std::list<TokenAndName> mTemplateInstantiations;
+    /** the elements of mTemplateInstantiations - the instantiations of a token are found through its template simplifier pointers */
+    std::unordered_set<const TokenAndName *> mTemplateInstantiationSet;
+    /** number of elements of mTemplateInstantiations per name */
+    std::unordered_map<std::string, int> mTemplateInstantiationNames;
     std::list<TokenAndName> mInstantiatedTemplates;
     std::list<TokenAndName> mMemberFunctionsToDelete;
     std::vector<TokenAndName> mExplicitInstantiationsToDelete;
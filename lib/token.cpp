@@ -23,23 +23,29 @@
 #include "library.h"
 #include "mathlib.h"
 #include "settings.h"
+#include "stringpool.h"
 #include "symboldatabase.h"
+#include "tokenarena.h"
+#include "tokenindex.h"
 #include "tokenlist.h"
 #include "utils.h"
 #include "tokenrange.h"
 #include "valueflow.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <cctype>
 #include <climits>
 #include <cmath>
+#include <cstdint>
 #include <cstdio>
 #include <cstring>
 #include <functional>
 #include <iostream>
 #include <iterator>
 #include <map>
+#include <memory>
 #include <set>
 #include <sstream>
 #include <stack>
@@ -58,19 +64,25 @@ namespace {
     };
 }
 
-const std::list<ValueFlow::Value> Token::mEmptyValueList;
+const ValueFlow::ValueList Token::mEmptyValueList{};
 const std::string Token::mEmptyString;
 
 Token::Token(const TokenList& tokenlist, std::shared_ptr<TokensFrontBack> tokensFrontBack)
+    : Token(tokenlist, tokensFrontBack, tokensFrontBack ? tokensFrontBack->arena : nullptr)
+{}
+
+Token::Token(const TokenList& tokenlist, std::shared_ptr<TokensFrontBack> tokensFrontBack, TokenArena *arena)
     : mList(tokenlist)
     , mTokensFrontBack(std::move(tokensFrontBack))
-    , mImpl(new Impl)
+    , mArena(arena)
+    , mImpl(arena ? new (*arena) Impl : new Impl)
     , mIsC(mList.isC())
     , mIsCpp(mList.isCPP())
 {}
 
+// the copy and the tokens inserted after it are not part of the list so they must not use its arena - the checks might run in parallel
 Token::Token(const Token* tok)
-    : Token(tok->mList, const_cast<Token*>(tok)->mTokensFrontBack)
+    : Token(tok->mList, const_cast<Token*>(tok)->mTokensFrontBack, nullptr)
 {
     fileIndex(tok->fileIndex());
     linenr(tok->linenr());
@@ -78,9 +90,67 @@ Token::Token(const Token* tok)
 
 Token::~Token()
 {
+    if (mArena)
+        mTokensFrontBack->index.update(this, mStr, nullptr);
     delete mImpl;
 }
 
+const std::string *Token::intern(const std::string &s) const
+{
+    // standalone tokens might be modified by checks running in parallel
+    if (mArena)
+        return mTokensFrontBack->strings.intern(s);
+    return StringPool::internShared(s);
+}
+
+void Token::assignStr(const std::string *s)
+{
+    // standalone tokens are not part of the list
+    if (mArena)
+        mTokensFrontBack->index.update(this, mStr, s);
+    mStr = s;
+}
+
+void *Token::operator new(std::size_t size)
+{
+    return TokenArena::allocate(size, nullptr);
+}
+
+void *Token::operator new(std::size_t size, TokenArena &arena)
+{
+    return TokenArena::allocate(size, &arena);
+}
+
+void Token::operator delete(void *p)
+{
+    TokenArena::deallocate(p);
+}
+
+void Token::operator delete(void *p, TokenArena & /*arena*/)
+{
+    TokenArena::deallocate(p);
+}
+
+void *Token::Impl::operator new(std::size_t size)
+{
+    return TokenArena::allocate(size, nullptr);
+}
+
+void *Token::Impl::operator new(std::size_t size, TokenArena &arena)
+{
+    return TokenArena::allocate(size, &arena);
+}
+
+void Token::Impl::operator delete(void *p)
+{
+    TokenArena::deallocate(p);
+}
+
+void Token::Impl::operator delete(void *p, TokenArena & /*arena*/)
+{
+    TokenArena::deallocate(p);
+}
+
 /*
  * Get a TokenRange which starts at this token and contains every token following it in order up to but not including 't'
  * e.g. for the sequence of tokens A B C D E, C.until(E) would yield the Range C D
@@ -114,8 +184,9 @@ void Token::update_property_info()
     // TODO: clear fIsLong
     isStandardType(false);
 
-    if (!mStr.empty()) {
-        if (mStr == "true" || mStr == "false") {
+    const std::string &s = *mStr;
+    if (!s.empty()) {
+        if (s == "true" || s == "false") {
             if (mImpl->mVarId) {
                 if (mIsCpp)
                     throw InternalError(this, "Internal error. VarId set for bool literal.");
@@ -124,24 +195,24 @@ void Token::update_property_info()
             else
                 tokType(eBoolean);
         }
-        else if (isStringLiteral(mStr)) {
+        else if (isStringLiteral(s)) {
             tokType(eString);
-            isLong(isPrefixStringCharLiteral(mStr, '"', "L"));
+            isLong(isPrefixStringCharLiteral(s, '"', "L"));
         }
-        else if (isCharLiteral(mStr)) {
+        else if (isCharLiteral(s)) {
             tokType(eChar);
-            isLong(isPrefixStringCharLiteral(mStr, '\'', "L"));
+            isLong(isPrefixStringCharLiteral(s, '\'', "L"));
         }
-        else if (std::isalpha(static_cast<unsigned char>(mStr[0])) || mStr[0] == '_' || mStr[0] == '$') { // Name
+        else if (std::isalpha(static_cast<unsigned char>(s[0])) || s[0] == '_' || s[0] == '$') { // Name
             if (mImpl->mVarId)
                 tokType(eVariable);
-            else if (mList.isKeyword(mStr)) {
+            else if (mList.isKeyword(s)) {
                 tokType(eKeyword);
                 update_property_isStandardType();
                 if (mTokType != eType) // cannot be a control-flow keyword when it is a type
-                    setFlag(fIsControlFlowKeyword, controlFlowKeywords.find(mStr) != controlFlowKeywords.end());
+                    setFlag(fIsControlFlowKeyword, controlFlowKeywords.find(s) != controlFlowKeywords.end());
             }
-            else if (mStr == "asm") { // TODO: not a keyword
+            else if (s == "asm") { // TODO: not a keyword
                 tokType(eKeyword);
             }
             else {
@@ -149,43 +220,43 @@ void Token::update_property_info()
                 // some types are not being treated as keywords
                 update_property_isStandardType();
             }
-        } else if (simplecpp::Token::isNumberLike(mStr)) {
-            if ((MathLib::isInt(mStr) || MathLib::isFloat(mStr)) && mStr.find('_') == std::string::npos)
+        } else if (simplecpp::Token::isNumberLike(s)) {
+            if ((MathLib::isInt(s) || MathLib::isFloat(s)) && s.find('_') == std::string::npos)
                 tokType(eNumber);
             else
                 tokType(eLiteral); // assume it is a user defined literal
-        } else if (mStr == "=" || mStr == "<<=" || mStr == ">>=" ||
-                   (mStr.size() == 2U && mStr[1] == '=' && std::strchr("+-*/%&^|", mStr[0])))
+        } else if (s == "=" || s == "<<=" || s == ">>=" ||
+                   (s.size() == 2U && s[1] == '=' && std::strchr("+-*/%&^|", s[0])))
             tokType(eAssignmentOp);
-        else if (mStr.size() == 1 && mStr.find_first_of(",[]()?:") != std::string::npos)
+        else if (s.size() == 1 && s.find_first_of(",[]()?:") != std::string::npos)
             tokType(eExtendedOp);
-        else if (mStr=="<<" || mStr==">>" || (mStr.size()==1 && mStr.find_first_of("+-*/%") != std::string::npos))
+        else if (s=="<<" || s==">>" || (s.size()==1 && s.find_first_of("+-*/%") != std::string::npos))
             tokType(eArithmeticalOp);
-        else if (mStr.size() == 1 && mStr.find_first_of("&|^~") != std::string::npos)
+        else if (s.size() == 1 && s.find_first_of("&|^~") != std::string::npos)
             tokType(eBitOp);
-        else if (mStr.size() <= 2 &&
-                 (mStr == "&&" ||
-                  mStr == "||" ||
-                  mStr == "!"))
+        else if (s.size() <= 2 &&
+                 (s == "&&" ||
+                  s == "||" ||
+                  s == "!"))
             tokType(eLogicalOp);
         // TODO: should link check only apply to < and >? Token::link() suggests so
-        else if (mStr.size() <= 2 && !mLink &&
-                 (mStr == "==" ||
-                  mStr == "!=" ||
-                  mStr == "<" ||
-                  mStr == "<=" ||
-                  mStr == ">" ||
-                  mStr == ">="))
+        else if (s.size() <= 2 && !mLink &&
+                 (s == "==" ||
+                  s == "!=" ||
+                  s == "<" ||
+                  s == "<=" ||
+                  s == ">" ||
+                  s == ">="))
             tokType(eComparisonOp);
-        else if (mStr == "<=>")
+        else if (s == "<=>")
             tokType(eComparisonOp);
-        else if (mStr.size() == 2 &&
-                 (mStr == "++" ||
-                  mStr == "--"))
+        else if (s.size() == 2 &&
+                 (s == "++" ||
+                  s == "--"))
             tokType(eIncDecOp);
-        else if (mStr.size() == 1 && (mStr.find_first_of("{}") != std::string::npos || (mLink && mStr.find_first_of("<>") != std::string::npos)))
+        else if (s.size() == 1 && (s.find_first_of("{}") != std::string::npos || (mLink && s.find_first_of("<>") != std::string::npos)))
             tokType(eBracket);
-        else if (mStr == "...")
+        else if (s == "...")
             tokType(eEllipsis);
         else
             tokType(eOther);
@@ -217,10 +288,10 @@ bool Token::isStandardType(const std::string& s)
 
 void Token::update_property_isStandardType()
 {
-    if (mStr.size() < 3 || mStr.size() > 7)
+    if (mStr->size() < 3 || mStr->size() > 7)
         return;
 
-    if (isStandardType(mStr)) {
+    if (isStandardType(*mStr)) {
         isStandardType(true);
         tokType(eType);
     }
@@ -230,26 +301,28 @@ bool Token::isUpperCaseName() const
 {
     if (!isName())
         return false;
-    return std::none_of(mStr.begin(), mStr.end(), [](char c) {
+    return std::none_of(mStr->cbegin(), mStr->cend(), [](char c) {
         return std::islower(c);
     });
 }
 
 void Token::concatStr(std::string const& b)
 {
-    mStr.pop_back();
-    mStr.append(getStringLiteral(b) + "\"");
+    std::string s = *mStr;
+    s.pop_back();
+    s.append(getStringLiteral(b) + "\"");
 
     if (isCChar() && isStringLiteral(b) && b[0] != '"') {
-        mStr.insert(0, b.substr(0, b.find('"')));
+        s.insert(0, b.substr(0, b.find('"')));
     }
+    assignStr(intern(s));
     update_property_info();
 }
 
 std::string Token::strValue() const
 {
     assert(mTokType == eString);
-    std::string ret(getStringLiteral(mStr));
+    std::string ret(getStringLiteral(*mStr));
     std::string::size_type pos = 0U;
     while ((pos = ret.find('\\', pos)) != std::string::npos) {
         ret.erase(pos,1U);
@@ -311,19 +384,21 @@ void Token::deletePrevious(nonneg int count)
 void Token::swapWithNext()
 {
     if (mNext) {
-        std::swap(mStr, mNext->mStr);
+        const std::string *s = mStr;
+        assignStr(mNext->mStr);
+        mNext->assignStr(s);
         std::swap(mTokType, mNext->mTokType);
         std::swap(mFlags, mNext->mFlags);
         std::swap(mImpl, mNext->mImpl);
-        if (mImpl->mTemplateSimplifierPointers)
+        if (templateSimplifierPointers())
             // cppcheck-suppress shadowFunction - TODO: fix this
-            for (auto *templateSimplifierPointer : *mImpl->mTemplateSimplifierPointers) {
+            for (auto *templateSimplifierPointer : *templateSimplifierPointers()) {
                 templateSimplifierPointer->token(this);
             }
 
-        if (mNext->mImpl->mTemplateSimplifierPointers)
+        if (mNext->templateSimplifierPointers())
             // cppcheck-suppress shadowFunction - TODO: fix this
-            for (auto *templateSimplifierPointer : *mNext->mImpl->mTemplateSimplifierPointers) {
+            for (auto *templateSimplifierPointer : *mNext->templateSimplifierPointers()) {
                 templateSimplifierPointer->token(mNext);
             }
         if (mNext->mLink)
@@ -336,15 +411,15 @@ void Token::swapWithNext()
 
 void Token::takeData(Token *fromToken)
 {
-    mStr = fromToken->mStr;
+    assignStr(fromToken->mStr);
     tokType(fromToken->mTokType);
     mFlags = fromToken->mFlags;
     delete mImpl;
     mImpl = fromToken->mImpl;
     fromToken->mImpl = nullptr;
-    if (mImpl->mTemplateSimplifierPointers)
+    if (templateSimplifierPointers())
         // cppcheck-suppress shadowFunction - TODO: fix this
-        for (auto *templateSimplifierPointer : *mImpl->mTemplateSimplifierPointers) {
+        for (auto *templateSimplifierPointer : *templateSimplifierPointers()) {
             templateSimplifierPointer->token(this);
         }
     mLink = fromToken->mLink;
@@ -620,7 +695,7 @@ bool Token::simpleMatch(const Token *tok, const char pattern[], size_t pattern_l
     while (*current) {
         const std::size_t length = next - current;
 
-        if (!tok || length != tok->mStr.length() || std::strncmp(current, tok->mStr.c_str(), length) != 0)
+        if (!tok || length != tok->mStr->length() || std::strncmp(current, tok->mStr->c_str(), length) != 0)
             return false;
 
         current = next;
@@ -663,7 +738,7 @@ const char *Token::chrInFirstWord(const char *s, char c)
     }
 }
 
-bool Token::Match(const Token *tok, const char pattern[], nonneg int varid)
+bool Token::matchPattern(const Token *tok, const char pattern[], nonneg int varid)
 {
     if (!(*pattern))
         return true;
@@ -752,6 +827,290 @@ bool Token::Match(const Token *tok, const char pattern[], nonneg int varid)
     return true;
 }
 
+namespace {
+    /** A Token::Match() pattern which has been parsed */
+    class MatchPattern {
+    public:
+        explicit MatchPattern(const char pattern[]);
+
+        bool match(const Token *tok, nonneg int varid) const;
+
+        /** the parsed pattern */
+        const char * const source;
+
+        /** the pattern uses a syntax which is not supported here - it needs to be interpreted */
+        bool unsupported{};
+
+    private:
+        /** An alternative of a word in the pattern - "int" or "%name%" in "int|%name%" */
+        struct Alternative {
+            enum class Kind : std::uint8_t { Str, Any, Assign, Bool, Char, Comp, Cop, Name, Num, Op, Or, OrOr, String, Type, Var, VarId };
+            Kind kind{Kind::Str};
+            /** the shared instance of str if it is predefined - the tokens are then compared by the address of their string */
+            const std::string *predefined{};
+            std::string str;
+        };
+
+        /** A word in the pattern - it is matched against a single token */
+        struct Word {
+            enum class Kind : std::uint8_t { Alternatives, Chars, Not };
+            Kind kind{Kind::Alternatives};
+            /** "int|char|" - the word also matches no token */
+            bool optional{};
+            std::vector<Alternative> alternatives;
+            /** the characters of "[abc]" or the string of "!!else" */
+            std::string str;
+        };
+
+        static bool parseWord(const std::string &word, Word &w);
+
+        /** @return 1 if the token matches, 0 if the word matches no token, -1 if it does not match */
+        static int matchWord(const Word &w, const Token *tok, nonneg int varid);
+
+        std::vector<Word> mWords;
+    };
+}
+
+bool MatchPattern::parseWord(const std::string &word, Word &w)
+{
+    if (word[0] == '[' && word.find(']') != std::string::npos) {
+        w.kind = Word::Kind::Chars;
+        int count = 0;
+        for (std::size_t i = 1; i < word.size(); ++i) {
+            if (word[i] == ']')
+                ++count;
+            else
+                w.str += word[i];
+        }
+        if (count > 1)
+            w.str += ']';
+        return true;
+    }
+
+    // "!!" is only a "not" if it is followed by another word
+    if (word == "!!")
+        return false;
+
+    if (word.size() > 2 && word[0] == '!' && word[1] == '!') {
+        w.kind = Word::Kind::Not;
+        w.str = word.substr(2);
+        return true;
+    }
+
+    static const std::pair<const char *, Alternative::Kind> commands[] = {
+        {"%any%", Alternative::Kind::Any},
+        {"%assign%", Alternative::Kind::Assign},
+        {"%bool%", Alternative::Kind::Bool},
+        {"%char%", Alternative::Kind::Char},
+        {"%comp%", Alternative::Kind::Comp},
+        {"%cop%", Alternative::Kind::Cop},
+        {"%name%", Alternative::Kind::Name},
+        {"%num%", Alternative::Kind::Num},
+        {"%op%", Alternative::Kind::Op},
+        {"%or%", Alternative::Kind::Or},
+        {"%oror%", Alternative::Kind::OrOr},
+        {"%str%", Alternative::Kind::String},
+        {"%type%", Alternative::Kind::Type},
+        {"%var%", Alternative::Kind::Var},
+        {"%varid%", Alternative::Kind::VarId}
+    };
+
+    std::string::size_type start = 0;
+    for (;;) {
+        const std::string::size_type end = word.find('|', start);
+        const std::string alternative = word.substr(start, end == std::string::npos ? std::string::npos : end - start);
+        if (alternative.empty()) {
+            // only a trailing '|' has a well defined meaning
+            if (end != std::string::npos || start == 0)
+                return false;
+            w.optional = true;
+            return true;
+        }
+        Alternative a;
+        if (alternative.size() > 1 && alternative[0] == '%' && alternative[1] != '=') {
+            const auto it = std::find_if(std::begin(commands), std::end(commands), [&](const std::pair<const char *, Alternative::Kind> &c) {
+                return alternative == c.first;
+            });
+            if (it == std::end(commands))
+                return false;
+            a.kind = it->second;
+        } else {
+            a.str = alternative;
+            a.predefined = StringPool::predefined(alternative);
+        }
+        w.alternatives.push_back(std::move(a));
+        if (end == std::string::npos)
+            return true;
+        start = end + 1;
+    }
+}
+
+MatchPattern::MatchPattern(const char pattern[])
+    : source(pattern)
+{
+    for (const char *p = pattern; *p;) {
+        if (*p == ' ') {
+            ++p;
+            continue;
+        }
+        const char *end = std::strchr(p, ' ');
+        if (!end)
+            end = p + std::strlen(p);
+        Word w;
+        if (!parseWord(std::string(p, end), w)) {
+            unsupported = true;
+            mWords.clear();
+            return;
+        }
+        mWords.push_back(std::move(w));
+        p = end;
+    }
+}
+
+int MatchPattern::matchWord(const Word &w, const Token *tok, nonneg int varid)
+{
+    for (const Alternative &a : w.alternatives) {
+        switch (a.kind) {
+        case Alternative::Kind::Str:
+            if (a.predefined ? &tok->str() == a.predefined : tok->str() == a.str)
+                return 1;
+            break;
+        case Alternative::Kind::Any:
+            return 1;
+        case Alternative::Kind::Assign:
+            if (tok->isAssignmentOp())
+                return 1;
+            break;
+        case Alternative::Kind::Bool:
+            if (tok->isBoolean())
+                return 1;
+            break;
+        case Alternative::Kind::Char:
+            if (tok->tokType() == Token::eChar)
+                return 1;
+            break;
+        case Alternative::Kind::Comp:
+            if (tok->isComparisonOp())
+                return 1;
+            break;
+        case Alternative::Kind::Cop:
+            if (tok->isConstOp())
+                return 1;
+            break;
+        case Alternative::Kind::Name:
+            if (tok->isName())
+                return 1;
+            break;
+        case Alternative::Kind::Num:
+            if (tok->isNumber())
+                return 1;
+            break;
+        case Alternative::Kind::Op:
+            if (tok->isOp())
+                return 1;
+            break;
+        case Alternative::Kind::Or:
+            if (tok->tokType() == Token::eBitOp && tok->str() == "|")
+                return 1;
+            break;
+        case Alternative::Kind::OrOr:
+            if (tok->tokType() == Token::eLogicalOp && tok->str() == "||")
+                return 1;
+            break;
+        case Alternative::Kind::String:
+            if (tok->tokType() == Token::eString)
+                return 1;
+            break;
+        case Alternative::Kind::Type:
+            if (tok->isName() && tok->varId() == 0)
+                return 1;
+            break;
+        case Alternative::Kind::Var:
+            if (tok->varId() != 0)
+                return 1;
+            break;
+        case Alternative::Kind::VarId:
+            if (varid == 0)
+                throw InternalError(tok, "Internal error. Token::Match called with varid 0.");
+            if (tok->varId() == varid)
+                return 1;
+            break;
+        }
+    }
+    return w.optional ? 0 : -1;
+}
+
+bool MatchPattern::match(const Token *tok, nonneg int varid) const
+{
+    for (const Word &w : mWords) {
+        if (!tok) {
+            // If we have no tokens, pattern "!!else" should return true
+            if (w.kind == Word::Kind::Not)
+                continue;
+            return false;
+        }
+        switch (w.kind) {
+        case Word::Kind::Chars:
+            if (tok->str().length() != 1 || w.str.find(tok->str()[0]) == std::string::npos)
+                return false;
+            break;
+        case Word::Kind::Not:
+            if (tok->str() == w.str)
+                return false;
+            break;
+        case Word::Kind::Alternatives: {
+            const int res = matchWord(w, tok, varid);
+            if (res == 0) // Empty alternative matches, use the same token for the next word
+                continue;
+            if (res == -1)
+                return false;
+            break;
+        }
+        }
+        tok = tok->next();
+    }
+    return true;
+}
+
+/**
+ * Get the parsed pattern of a string literal. The parsed patterns are never freed - like
+ * the literals. They are stored in a lock-free hash table which is indexed by the address
+ * of the literal.
+ * @return nullptr if the table is full
+ */
+static const MatchPattern *getMatchPattern(const char pattern[])
+{
+    static constexpr std::size_t tableSize = 1 << 14;
+    static constexpr std::size_t maxProbes = 16;
+    static std::atomic<const MatchPattern *> table[tableSize];
+
+    auto hash = reinterpret_cast<std::uintptr_t>(pattern);
+    hash ^= hash >> 15;
+    for (std::size_t probe = 0; probe < maxProbes; ++probe) {
+        std::atomic<const MatchPattern *> &slot = table[(hash + probe) % tableSize];
+        const MatchPattern *p = slot.load(std::memory_order_acquire);
+        if (!p) {
+            std::unique_ptr<MatchPattern> parsed(new MatchPattern(pattern));
+            if (slot.compare_exchange_strong(p, parsed.get(), std::memory_order_acq_rel))
+                return parsed.release();
+            // another thread has filled the slot in the meantime - p is its pattern
+        }
+        if (p->source == pattern) {
+            assert(std::strcmp(p->source, pattern) == 0);
+            return p;
+        }
+    }
+    return nullptr;
+}
+
+bool Token::matchLiteral(const Token *tok, const char pattern[], nonneg int varid)
+{
+    const MatchPattern *p = getMatchPattern(pattern);
+    if (!p || p->unsupported)
+        return matchPattern(tok, pattern, varid);
+    return p->match(tok, varid);
+}
+
 nonneg int Token::getStrLength(const Token *tok)
 {
     assert(tok != nullptr);
@@ -874,7 +1233,7 @@ static bool isOperator(const Token *tok)
 
 const Token * Token::findClosingBracket() const
 {
-    if (mStr != "<")
+    if (*mStr != "<")
         return nullptr;
 
     if (!mPrevious)
@@ -939,7 +1298,7 @@ Token * Token::findClosingBracket()
 
 const Token * Token::findOpeningBracket() const
 {
-    if (mStr != ">")
+    if (*mStr != ">")
         return nullptr;
 
     const Token *opening = nullptr;
@@ -1063,10 +1422,12 @@ void Token::function(const Function *f)
 Token* Token::insertToken(const std::string& tokenStr, bool prepend)
 {
     Token *newToken;
-    if (mStr.empty())
+    if (mStr->empty())
         newToken = this;
+    else if (mArena)
+        newToken = new (*mArena) Token(mList, mTokensFrontBack, mArena);
     else
-        newToken = new Token(mList, mTokensFrontBack);
+        newToken = new Token(mList, mTokensFrontBack, nullptr);
     newToken->str(tokenStr);
 
     if (newToken != this) {
@@ -1094,7 +1455,8 @@ Token* Token::insertToken(const std::string& tokenStr, bool prepend)
             newToken->previous(this);
         }
 
-        if (mImpl->mScopeInfo) {
+        const std::shared_ptr<ScopeInfo2> currentScopeInfo = scopeInfo();
+        if (currentScopeInfo) {
             // If the brace is immediately closed there is no point opening a new scope for it
             if (newToken->str() == "{") {
                 std::string nextScopeNameAddition;
@@ -1146,7 +1508,7 @@ Token* Token::insertToken(const std::string& tokenStr, bool prepend)
                 }
 
                 // New scope is opening, record it here
-                std::shared_ptr<ScopeInfo2> newScopeInfo = std::make_shared<ScopeInfo2>(mImpl->mScopeInfo->name, nullptr, mImpl->mScopeInfo->usingNamespaces);
+                std::shared_ptr<ScopeInfo2> newScopeInfo = std::make_shared<ScopeInfo2>(currentScopeInfo->name, nullptr, currentScopeInfo->usingNamespaces);
 
                 if (!newScopeInfo->name.empty() && !nextScopeNameAddition.empty()) newScopeInfo->name.append(" :: ");
                 newScopeInfo->name.append(nextScopeNameAddition);
@@ -1162,13 +1524,13 @@ Token* Token::insertToken(const std::string& tokenStr, bool prepend)
                     matchingTok = matchingTok->previous();
                 }
                 if (matchingTok && matchingTok->previous()) {
-                    newToken->mImpl->mScopeInfo = matchingTok->previous()->scopeInfo();
+                    newToken->scopeInfo(matchingTok->previous()->scopeInfo());
                 }
             } else {
                 if (prepend && newToken->previous()) {
-                    newToken->mImpl->mScopeInfo = newToken->previous()->scopeInfo();
+                    newToken->scopeInfo(newToken->previous()->scopeInfo());
                 } else {
-                    newToken->mImpl->mScopeInfo = mImpl->mScopeInfo;
+                    newToken->scopeInfo(currentScopeInfo);
                 }
                 if (newToken->str() == ";") {
                     const Token* statementStart = newToken;
@@ -1184,7 +1546,7 @@ Token* Token::insertToken(const std::string& tokenStr, bool prepend)
                             nameSpace += tok1->str();
                             tok1 = tok1->next();
                         }
-                        mImpl->mScopeInfo->usingNamespaces.insert(std::move(nameSpace));
+                        currentScopeInfo->usingNamespaces.insert(std::move(nameSpace));
                     }
                 }
             }
@@ -1283,15 +1645,15 @@ std::string Token::stringify(const stringifyOptions& options) const
     }
     if (options.macro && isExpandedMacro())
         ret += '$';
-    if (isName() && mStr.find(' ') != std::string::npos) {
-        for (const char i : mStr) {
+    if (isName() && mStr->find(' ') != std::string::npos) {
+        for (const char i : *mStr) {
             if (i != ' ')
                 ret += i;
         }
-    } else if (mStr[0] != '\"' || mStr.find('\0') == std::string::npos)
-        ret += mStr;
+    } else if ((*mStr)[0] != '\"' || mStr->find('\0') == std::string::npos)
+        ret += *mStr;
     else {
-        for (const char i : mStr) {
+        for (const char i : *mStr) {
             if (i == '\0')
                 ret += "\\0";
             else
@@ -1699,7 +2061,7 @@ void Token::astStringVerboseRecursive(std::string& ret, const nonneg int indent1
 {
     if (isExpandedMacro())
         ret += '$';
-    ret += mStr;
+    ret += *mStr;
     if (mImpl->mValueType)
         ret += " \'" + mImpl->mValueType->str() + '\'';
     if (function()) {
@@ -2024,17 +2386,17 @@ static bool isAdjacent(const ValueFlow::Value& x, const ValueFlow::Value& y)
     return std::abs(x.intvalue - y.intvalue) == 1;
 }
 
-static bool removePointValue(std::list<ValueFlow::Value>& values, std::list<ValueFlow::Value>::iterator& x)
+static bool removePointValue(ValueFlow::ValueList& values, ValueFlow::ValueList::iterator x)
 {
     const bool isPoint = x->bound == ValueFlow::Value::Bound::Point;
     if (!isPoint)
         x->decreaseRange();
     else
-        x = values.erase(x);
+        values.erase(x);
     return isPoint;
 }
 
-static bool removeContradiction(std::list<ValueFlow::Value>& values)
+static bool removeContradiction(ValueFlow::ValueList& values)
 {
     bool result = false;
     for (auto itx = values.begin(); itx != values.end(); ++itx) {
@@ -2055,7 +2417,7 @@ static bool removeContradiction(std::list<ValueFlow::Value>& values)
             if (itx->isSymbolicValue() && !ValueFlow::Value::sameToken(itx->tokvalue, ity->tokvalue))
                 continue;
             if (!itx->equalValue(*ity)) {
-                auto compare = [](const std::list<ValueFlow::Value>::const_iterator& x, const std::list<ValueFlow::Value>::const_iterator& y) {
+                auto compare = [](ValueFlow::ValueList::const_iterator x, ValueFlow::ValueList::const_iterator y) {
                     return x->compareValue(*y, less{});
                 };
                 auto itMax = std::max(itx, ity, compare);
@@ -2073,20 +2435,21 @@ static bool removeContradiction(std::list<ValueFlow::Value>& values)
             }
             const bool removex = !itx->isImpossible() || ity->isKnown();
             const bool removey = !ity->isImpossible() || itx->isKnown();
+            // ity is after itx - so it is removed first to keep itx valid
             if (itx->bound == ity->bound) {
-                if (removex)
-                    values.erase(itx);
                 if (removey)
                     values.erase(ity);
+                if (removex)
+                    values.erase(itx);
                 // itx and ity are invalidated
                 return true;
             }
             result = removex || removey;
             bool bail = false;
-            if (removex && removePointValue(values, itx))
-                bail = true;
             if (removey && removePointValue(values, ity))
                 bail = true;
+            if (removex && removePointValue(values, itx))
+                bail = true;
             if (bail)
                 return true;
         }
@@ -2094,11 +2457,11 @@ static bool removeContradiction(std::list<ValueFlow::Value>& values)
     return result;
 }
 
-using ValueIterator = std::list<ValueFlow::Value>::iterator;
+using ValueIterator = ValueFlow::ValueList::iterator;
 
 template<class Iterator>
 // NOLINTNEXTLINE(performance-unnecessary-value-param) - false positive
-static ValueIterator removeAdjacentValues(std::list<ValueFlow::Value>& values, ValueIterator x, Iterator start, Iterator last)
+static ValueIterator removeAdjacentValues(ValueFlow::ValueList& values, ValueIterator x, Iterator start, Iterator last)
 {
     if (!isAdjacent(*x, **start))
         return std::next(x);
@@ -2108,13 +2471,19 @@ static ValueIterator removeAdjacentValues(std::list<ValueFlow::Value>& values, V
     if (it == last)
         it--;
     (*it)->bound = x->bound;
-    std::for_each(std::move(start), std::move(it), [&](ValueIterator y) {
-        values.erase(y);
+    // the values are removed from the back so the remaining iterators stay valid
+    std::vector<ValueIterator> removed(std::move(start), std::move(it));
+    removed.push_back(x);
+    std::sort(removed.begin(), removed.end(), std::greater<ValueIterator>{});
+    const std::ptrdiff_t next = (x - values.begin()) - std::count_if(removed.cbegin(), removed.cend(), [&](ValueIterator y) {
+        return y < x;
     });
-    return values.erase(x);
+    for (ValueIterator y : removed)
+        values.erase(y);
+    return values.begin() + next;
 }
 
-static void mergeAdjacent(std::list<ValueFlow::Value>& values)
+static void mergeAdjacent(ValueFlow::ValueList& values)
 {
     for (auto x = values.begin(); x != values.end();) {
         if (x->isNonValue()) {
@@ -2170,16 +2539,16 @@ static void mergeAdjacent(std::list<ValueFlow::Value>& values)
     }
 }
 
-static void removeOverlaps(std::list<ValueFlow::Value>& values)
+static void removeOverlaps(ValueFlow::ValueList& values)
 {
-    for (const ValueFlow::Value& x : values) {
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        const ValueFlow::Value& x = values.begin()[i];
         if (x.isNonValue())
             continue;
-        values.remove_if([&](const ValueFlow::Value& y) {
+        // the values before x have been compared with it already
+        const auto last = std::remove_if(values.begin() + i + 1, values.end(), [&](const ValueFlow::Value& y) {
             if (y.isNonValue())
                 return false;
-            if (&x == &y)
-                return false;
             if (x.valueType != y.valueType)
                 return false;
             if (x.valueKind != y.valueKind)
@@ -2192,13 +2561,14 @@ static void removeOverlaps(std::list<ValueFlow::Value>& values)
                 return false;
             return true;
         });
+        values.erase(last, values.end());
     }
     mergeAdjacent(values);
 }
 
 // Removing contradictions is an NP-hard problem. Instead we run multiple
 // passes to try to catch most contradictions
-static void removeContradictions(std::list<ValueFlow::Value>& values)
+static void removeContradictions(ValueFlow::ValueList& values)
 {
     removeOverlaps(values);
     for (int i = 0; i < 4; i++) {
@@ -2288,7 +2658,7 @@ bool Token::addValue(const ValueFlow::Value &value)
         ValueFlow::Value v(value);
         if (v.varId == 0)
             v.varId = mImpl->mVarId;
-        mImpl->mValues = new std::list<ValueFlow::Value>;
+        mImpl->mValues = new (TokenArena::allocate(sizeof(ValueFlow::ValueList), mArena)) ValueFlow::ValueList;
         mImpl->mValues->push_back(std::move(v));
     }
 
@@ -2507,11 +2877,13 @@ std::string Token::typeStr(const Token* tok)
 
 void Token::scopeInfo(std::shared_ptr<ScopeInfo2> newScopeInfo)
 {
-    mImpl->mScopeInfo = std::move(newScopeInfo);
+    if (!newScopeInfo && !mImpl->mCold)
+        return;
+    mImpl->cold().mScopeInfo = std::move(newScopeInfo);
 }
 std::shared_ptr<ScopeInfo2> Token::scopeInfo() const
 {
-    return mImpl->mScopeInfo;
+    return mImpl->mCold ? mImpl->mCold->mScopeInfo : nullptr;
 }
 
 // if there is a known INT value it will always be the first entry
@@ -2579,7 +2951,7 @@ const ValueFlow::Value* Token::getValue(const MathLib::bigint val) const
 }
 
 template<class Compare>
-static const ValueFlow::Value* getCompareValue(const std::list<ValueFlow::Value>& values,
+static const ValueFlow::Value* getCompareValue(const ValueFlow::ValueList& values,
                                                bool condition,
                                                MathLib::bigint path,
                                                Compare compare)
@@ -2633,13 +3005,30 @@ const ValueFlow::Value* Token::getContainerSizeValue(const MathLib::bigint val)
     return it == mImpl->mValues->end() ? nullptr : &*it;
 }
 
+static void deleteValues(ValueFlow::ValueList *values)
+{
+    if (!values)
+        return;
+    values->~ValueList();
+    TokenArena::deallocate(values);
+}
+
+void Token::clearValueFlow()
+{
+    deleteValues(mImpl->mValues);
+    mImpl->mValues = nullptr;
+}
+
 Token::Impl::~Impl()
 {
     delete mMacroName;
     delete mOriginalName;
     delete mValueType;
-    delete mValues;
+    deleteValues(mValues);
+}
 
+Token::Impl::Cold::~Cold()
+{
     if (mTemplateSimplifierPointers) {
         for (auto *p : *mTemplateSimplifierPointers) {
             p->token(nullptr);
@@ -2654,9 +3043,17 @@ Token::Impl::~Impl()
     }
 }
 
+Token::Impl::Cold &Token::Impl::cold()
+{
+    if (!mCold)
+        mCold.reset(new Cold);
+    return *mCold;
+}
+
 void Token::Impl::setCppcheckAttribute(CppcheckAttributesType attrType, MathLib::bigint value)
 {
-    CppcheckAttributes *attr = mCppcheckAttributes;
+    Cold &c = cold();
+    CppcheckAttributes *attr = c.mCppcheckAttributes;
     while (attr && attr->type != attrType)
         attr = attr->next;
     if (attr)
@@ -2665,14 +3062,14 @@ void Token::Impl::setCppcheckAttribute(CppcheckAttributesType attrType, MathLib:
         attr = new CppcheckAttributes;
         attr->type = attrType;
         attr->value = value;
-        attr->next = mCppcheckAttributes;
-        mCppcheckAttributes = attr;
+        attr->next = c.mCppcheckAttributes;
+        c.mCppcheckAttributes = attr;
     }
 }
 
 bool Token::Impl::getCppcheckAttribute(CppcheckAttributesType attrType, MathLib::bigint &value) const
 {
-    const CppcheckAttributes *attr = mCppcheckAttributes;
+    const CppcheckAttributes *attr = mCold ? mCold->mCppcheckAttributes : nullptr;
     while (attr && attr->type != attrType)
         attr = attr->next;
     if (attr)
@@ -2726,17 +3123,21 @@ const Token* findLambdaEndScope(const Token* tok) {
 
 void Token::templateArgFrom(const Token* fromToken) {
     setFlag(fIsTemplateArg, fromToken != nullptr);
-    mImpl->mTemplateArgFileIndex = fromToken ? fromToken->mImpl->mFileIndex : -1;
-    mImpl->mTemplateArgLineNumber = fromToken ? fromToken->mImpl->mLineNumber : -1;
-    mImpl->mTemplateArgColumn = fromToken ? fromToken->mImpl->mColumn : -1;
+    if (!fromToken && !mImpl->mCold)
+        return;
+    Impl::Cold &cold = mImpl->cold();
+    cold.mTemplateArgFileIndex = fromToken ? fromToken->mImpl->mFileIndex : -1;
+    cold.mTemplateArgLineNumber = fromToken ? fromToken->mImpl->mLineNumber : -1;
+    cold.mTemplateArgColumn = fromToken ? fromToken->mImpl->mColumn : -1;
 }
 
 const SmallVector<ReferenceToken>& Token::refs(bool temporary) const
 {
     if (temporary) {
-        if (!mImpl->mRefsTemp)
-            mImpl->mRefsTemp.reset(new SmallVector<ReferenceToken>(followAllReferences(this, true)));
-        return *mImpl->mRefsTemp;
+        Impl::Cold &cold = mImpl->cold();
+        if (!cold.mRefsTemp)
+            cold.mRefsTemp.reset(new SmallVector<ReferenceToken>(followAllReferences(this, true)));
+        return *cold.mRefsTemp;
     }
 
     if (!mImpl->mRefs)
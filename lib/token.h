@@ -53,6 +53,7 @@ class ValueType;
 class Variable;
 class ConstTokenRange;
 class Token;
+class TokenArena;
 struct TokensFrontBack;
 class TokenList;
 struct ReferenceToken;
@@ -86,6 +87,9 @@ public:
     enum class Cpp11init : std::uint8_t { UNKNOWN, CPP11INIT, NOINIT };
 
 private:
+    /** @param arena the implementation data and the inserted tokens are allocated in this arena - or on the heap if it is nullptr */
+    Token(const TokenList& tokenlist, std::shared_ptr<TokensFrontBack> tokensFrontBack, TokenArena *arena);
+
     struct Impl {
         nonneg int mVarId{};
         nonneg int mFileIndex{};
@@ -93,11 +97,6 @@ private:
         nonneg int mColumn{};
         nonneg int mExprId{};
 
-        // original template argument location
-        int mTemplateArgFileIndex{-1};
-        int mTemplateArgLineNumber{-1};
-        int mTemplateArgColumn{-1};
-
         /**
          * A value from 0-100 that provides a rough idea about where in the token
          * list this token is located.
@@ -112,6 +111,13 @@ private:
         /** Bitfield bit count. */
         short mBits = -1;
 
+        // For memoization, to speed up parsing of huge arrays #8897
+        Cpp11init mCpp11init{Cpp11init::UNKNOWN};
+
+        TokenDebug mDebug{};
+
+        std::int8_t mMutableExpr{-1};
+
         // AST..
         Token* mAstOperand1{};
         Token* mAstOperand2{};
@@ -137,13 +143,9 @@ private:
         ValueType* mValueType{};
 
         // ValueFlow
-        std::list<ValueFlow::Value>* mValues{};
-
-        // Pointer to a template in the template simplifier
-        std::set<TemplateSimplifier::TokenAndName*>* mTemplateSimplifierPointers{};
+        ValueFlow::ValueList* mValues{};
 
-        // Pointer to the object representing this token's scope
-        std::shared_ptr<ScopeInfo2> mScopeInfo;
+        std::unique_ptr<SmallVector<ReferenceToken>> mRefs;
 
         // __cppcheck_in_range__
         struct CppcheckAttributes {
@@ -151,28 +153,45 @@ private:
             MathLib::bigint value{};
             CppcheckAttributes* next{};
         };
-        CppcheckAttributes* mCppcheckAttributes{};
-
-        // alignas expressions
-        std::unique_ptr<std::vector<std::string>> mAttributeAlignas;
-        void addAttributeAlignas(const std::string& a) {
-            if (!mAttributeAlignas)
-                mAttributeAlignas = std::unique_ptr<std::vector<std::string>>(new std::vector<std::string>());
-            if (std::find(mAttributeAlignas->cbegin(), mAttributeAlignas->cend(), a) == mAttributeAlignas->cend())
-                mAttributeAlignas->push_back(a);
-        }
 
-        std::string mAttributeCleanup;
+        /** The data which is only used for a few tokens - kept out of the way of the traversals */
+        struct Cold {
+            // original template argument location
+            int mTemplateArgFileIndex{-1};
+            int mTemplateArgLineNumber{-1};
+            int mTemplateArgColumn{-1};
 
-        // For memoization, to speed up parsing of huge arrays #8897
-        Cpp11init mCpp11init{Cpp11init::UNKNOWN};
+            // Pointer to a template in the template simplifier
+            std::set<TemplateSimplifier::TokenAndName*>* mTemplateSimplifierPointers{};
 
-        TokenDebug mDebug{};
+            // Pointer to the object representing this token's scope
+            std::shared_ptr<ScopeInfo2> mScopeInfo;
 
-        std::unique_ptr<SmallVector<ReferenceToken>> mRefs;
-        std::unique_ptr<SmallVector<ReferenceToken>> mRefsTemp;
+            CppcheckAttributes* mCppcheckAttributes{};
 
-        std::int8_t mMutableExpr{-1};
+            // alignas expressions
+            std::unique_ptr<std::vector<std::string>> mAttributeAlignas;
+            void addAttributeAlignas(const std::string& a) {
+                if (!mAttributeAlignas)
+                    mAttributeAlignas = std::unique_ptr<std::vector<std::string>>(new std::vector<std::string>());
+                if (std::find(mAttributeAlignas->cbegin(), mAttributeAlignas->cend(), a) == mAttributeAlignas->cend())
+                    mAttributeAlignas->push_back(a);
+            }
+
+            std::string mAttributeCleanup;
+
+            std::unique_ptr<SmallVector<ReferenceToken>> mRefsTemp;
+
+            Cold() = default;
+            ~Cold();
+
+            Cold(const Cold &) = delete;
+            Cold operator=(const Cold &) = delete;
+        };
+        std::unique_ptr<Cold> mCold;
+
+        /** get the cold data - it is allocated on first use */
+        Cold &cold();
 
         void setCppcheckAttribute(CppcheckAttributesType attrType, MathLib::bigint value);
         bool getCppcheckAttribute(CppcheckAttributesType attrType, MathLib::bigint &value) const;
@@ -180,12 +199,19 @@ private:
         Impl() = default;
         ~Impl();
 
+        static void *operator new(std::size_t size);
+        static void *operator new(std::size_t size, TokenArena &arena);
+        static void operator delete(void *p);
+        static void operator delete(void *p, TokenArena &arena);
+
         Impl(const Impl &) = delete;
         Impl operator=(const Impl &) = delete;
     };
 
     const TokenList& mList;
     std::shared_ptr<TokensFrontBack> mTokensFrontBack;
+    /** the arena the inserted tokens are allocated in - nullptr for standalone tokens */
+    TokenArena* mArena;
 
     static const std::string mEmptyString;
 
@@ -209,11 +235,17 @@ public:
     explicit Token(const Token *tok);
     ~Token();
 
+    /** the tokens of a list are allocated in the arena of the list - standalone tokens on the heap */
+    static void *operator new(std::size_t size);
+    static void *operator new(std::size_t size, TokenArena &arena);
+    static void operator delete(void *p);
+    static void operator delete(void *p, TokenArena &arena);
+
     ConstTokenRange until(const Token * t) const;
 
     template<typename T>
     void str(T&& s) {
-        mStr = s;
+        assignStr(intern(s));
         mImpl->mVarId = 0;
 
         update_property_info();
@@ -226,7 +258,7 @@ public:
     void concatStr(std::string const& b);
 
     const std::string &str() const {
-        return mStr;
+        return *mStr;
     }
 
     /**
@@ -278,7 +310,7 @@ public:
     const std::string &strAt(int idx) const
     {
         const Token *tok = this->tokAt(idx);
-        return tok ? tok->mStr : mEmptyString;
+        return tok ? *tok->mStr : mEmptyString;
     }
 
     /**
@@ -350,7 +382,27 @@ public:
      * @return true if given token matches with given pattern
      *         false if given token does not match with given pattern
      */
-    static bool Match(const Token *tok, const char pattern[], nonneg int varid = 0);
+    template<class T, REQUIRES("T must be a C string", std::is_convertible<T, const char*> )>
+    static bool Match(const Token *tok, T pattern, nonneg int varid = 0) {
+        return matchPattern(tok, pattern, varid);
+    }
+
+    /**
+     * Match() for a string literal. The pattern is parsed on the first call and the
+     * later calls only use the parsed pattern. The parsed patterns are looked up by
+     * the address of the literal, so an array passed as the pattern must be static and
+     * must never be modified.
+     */
+    template<size_t count>
+    static bool Match(const Token *tok, const char (&pattern)[count], nonneg int varid = 0) {
+        return matchLiteral(tok, pattern, varid);
+    }
+
+    /** Match() for a modifiable buffer - the pattern is parsed on every call */
+    template<size_t count>
+    static bool Match(const Token *tok, char (&pattern)[count], nonneg int varid = 0) {
+        return matchPattern(tok, pattern, varid);
+    }
 
     /**
      * @return length of C-string.
@@ -458,7 +510,7 @@ public:
         return astOperand1() != nullptr && astOperand2() != nullptr;
     }
     bool isUnaryOp(const std::string &s) const {
-        return s == mStr && astOperand1() != nullptr && astOperand2() == nullptr;
+        return s == *mStr && astOperand1() != nullptr && astOperand2() == nullptr;
     }
     bool isUnaryPreOp() const;
 
@@ -587,22 +639,22 @@ public:
         setFlag(fIsAttributeFallthrough, value);
     }
     std::vector<std::string> getAttributeAlignas() const {
-        return mImpl->mAttributeAlignas ? *mImpl->mAttributeAlignas : std::vector<std::string>();
+        return mImpl->mCold && mImpl->mCold->mAttributeAlignas ? *mImpl->mCold->mAttributeAlignas : std::vector<std::string>();
     }
     bool hasAttributeAlignas() const {
-        return !!mImpl->mAttributeAlignas;
+        return mImpl->mCold && mImpl->mCold->mAttributeAlignas;
     }
     void addAttributeAlignas(const std::string& a) {
-        mImpl->addAttributeAlignas(a);
+        mImpl->cold().addAttributeAlignas(a);
     }
     void addAttributeCleanup(const std::string& funcname) {
-        mImpl->mAttributeCleanup = funcname;
+        mImpl->cold().mAttributeCleanup = funcname;
     }
     const std::string& getAttributeCleanup() const {
-        return mImpl->mAttributeCleanup;
+        return mImpl->mCold ? mImpl->mCold->mAttributeCleanup : mEmptyString;
     }
     bool hasAttributeCleanup() const {
-        return !mImpl->mAttributeCleanup.empty();
+        return mImpl->mCold && !mImpl->mCold->mAttributeCleanup.empty();
     }
     void setCppcheckAttribute(CppcheckAttributesType attrType, MathLib::bigint value) {
         mImpl->setCppcheckAttribute(attrType, value);
@@ -612,7 +664,7 @@ public:
     }
     // cppcheck-suppress unusedFunction
     bool hasCppcheckAttributes() const {
-        return nullptr != mImpl->mCppcheckAttributes;
+        return mImpl->mCold && nullptr != mImpl->mCold->mCppcheckAttributes;
     }
     bool isControlFlowKeyword() const {
         return getFlag(fIsControlFlowKeyword);
@@ -783,15 +835,16 @@ public:
         return mImpl->mBits;
     }
     const std::set<TemplateSimplifier::TokenAndName*>* templateSimplifierPointers() const {
-        return mImpl->mTemplateSimplifierPointers;
+        return mImpl->mCold ? mImpl->mCold->mTemplateSimplifierPointers : nullptr;
     }
     std::set<TemplateSimplifier::TokenAndName*>* templateSimplifierPointers() {
-        return mImpl->mTemplateSimplifierPointers;
+        return mImpl->mCold ? mImpl->mCold->mTemplateSimplifierPointers : nullptr;
     }
     void templateSimplifierPointer(TemplateSimplifier::TokenAndName* tokenAndName) {
-        if (!mImpl->mTemplateSimplifierPointers)
-            mImpl->mTemplateSimplifierPointers = new std::set<TemplateSimplifier::TokenAndName*>;
-        mImpl->mTemplateSimplifierPointers->insert(tokenAndName);
+        Impl::Cold &cold = mImpl->cold();
+        if (!cold.mTemplateSimplifierPointers)
+            cold.mTemplateSimplifierPointers = new std::set<TemplateSimplifier::TokenAndName*>;
+        cold.mTemplateSimplifierPointers->insert(tokenAndName);
     }
     bool setBits(const MathLib::bigint b) {
         const MathLib::bigint max = std::numeric_limits<short>::max();
@@ -804,27 +857,27 @@ public:
     }
 
     bool isUtf8() const {
-        return (((mTokType == eString) && isPrefixStringCharLiteral(mStr, '"', "u8")) ||
-                ((mTokType == eChar) && isPrefixStringCharLiteral(mStr, '\'', "u8")));
+        return (((mTokType == eString) && isPrefixStringCharLiteral(*mStr, '"', "u8")) ||
+                ((mTokType == eChar) && isPrefixStringCharLiteral(*mStr, '\'', "u8")));
     }
 
     bool isUtf16() const {
-        return (((mTokType == eString) && isPrefixStringCharLiteral(mStr, '"', "u")) ||
-                ((mTokType == eChar) && isPrefixStringCharLiteral(mStr, '\'', "u")));
+        return (((mTokType == eString) && isPrefixStringCharLiteral(*mStr, '"', "u")) ||
+                ((mTokType == eChar) && isPrefixStringCharLiteral(*mStr, '\'', "u")));
     }
 
     bool isUtf32() const {
-        return (((mTokType == eString) && isPrefixStringCharLiteral(mStr, '"', "U")) ||
-                ((mTokType == eChar) && isPrefixStringCharLiteral(mStr, '\'', "U")));
+        return (((mTokType == eString) && isPrefixStringCharLiteral(*mStr, '"', "U")) ||
+                ((mTokType == eChar) && isPrefixStringCharLiteral(*mStr, '\'', "U")));
     }
 
     bool isCChar() const {
-        return (((mTokType == eString) && isPrefixStringCharLiteral(mStr, '"', "")) ||
-                ((mTokType == eChar) && isPrefixStringCharLiteral(mStr, '\'', "") && (replaceEscapeSequences(getCharLiteral(mStr)).size() == 1)));
+        return (((mTokType == eString) && isPrefixStringCharLiteral(*mStr, '"', "")) ||
+                ((mTokType == eChar) && isPrefixStringCharLiteral(*mStr, '\'', "") && (replaceEscapeSequences(getCharLiteral(*mStr)).size() == 1)));
     }
 
     bool isCMultiChar() const {
-        return (mTokType == eChar) && isPrefixStringCharLiteral(mStr, '\'', "") && (replaceEscapeSequences(getCharLiteral(mStr)).size() > 1);
+        return (mTokType == eChar) && isPrefixStringCharLiteral(*mStr, '\'', "") && (replaceEscapeSequences(getCharLiteral(*mStr)).size() > 1);
     }
 
     /**
@@ -849,13 +902,13 @@ public:
     }
     void templateArgFrom(const Token* fromToken);
     int templateArgFileIndex() const {
-        return mImpl->mTemplateArgFileIndex;
+        return mImpl->mCold ? mImpl->mCold->mTemplateArgFileIndex : -1;
     }
     int templateArgLineNumber() const {
-        return mImpl->mTemplateArgLineNumber;
+        return mImpl->mCold ? mImpl->mCold->mTemplateArgLineNumber : -1;
     }
     int templateArgColumn() const {
-        return mImpl->mTemplateArgColumn;
+        return mImpl->mCold ? mImpl->mCold->mTemplateArgColumn : -1;
     }
 
     const std::string& getMacroName() const {
@@ -1184,7 +1237,7 @@ public:
             return;
 
         mLink = linkToToken;
-        if (mStr == "<" || mStr == ">")
+        if (*mStr == "<" || *mStr == ">")
             update_property_info();
     }
 
@@ -1366,7 +1419,7 @@ public:
         return mImpl->mOriginalName ? *mImpl->mOriginalName : mEmptyString;
     }
 
-    const std::list<ValueFlow::Value>& values() const {
+    const ValueFlow::ValueList& values() const {
         return mImpl->mValues ? *mImpl->mValues : mEmptyValueList;
     }
 
@@ -1433,7 +1486,13 @@ public:
     void assignIndexes();
 
 private:
-    static const std::list<ValueFlow::Value> mEmptyValueList;
+    static const ValueFlow::ValueList mEmptyValueList;
+
+    /** set the interned string and update the TokenIndex of the list */
+    void assignStr(const std::string *s);
+
+    static bool matchPattern(const Token *tok, const char pattern[], nonneg int varid);
+    static bool matchLiteral(const Token *tok, const char pattern[], nonneg int varid);
 
     void next(Token *nextToken) {
         mNext = nextToken;
@@ -1463,7 +1522,8 @@ private:
     RET_NONNULL Token* insertToken(const std::string& tokenStr, const std::string& originalNameStr, bool prepend);
     RET_NONNULL Token* insertToken(const std::string& tokenStr, const std::string& originalNameStr, const std::string& macroNameStr, bool prepend);
 
-    std::string mStr;
+    /** interned in the StringPool of the list */
+    const std::string *mStr{&mEmptyString};
 
     Token* mNext{};
     Token* mPrevious{};
@@ -1548,6 +1608,9 @@ private:
         mFlags = state_ ? mFlags | flag_ : mFlags & ~flag_;
     }
 
+    /** Get the interned copy of a string from the pool of the list (or the shared one for standalone tokens) */
+    const std::string *intern(const std::string &s) const;
+
     /** Updates internal property cache like _isName or _isBoolean.
         Called after any mStr() modification.
         @throws InternalError thrown if a bool literal has a varid
@@ -1647,10 +1710,7 @@ public:
      */
     bool isCalculation() const;
 
-    void clearValueFlow() {
-        delete mImpl->mValues;
-        mImpl->mValues = nullptr;
-    }
+    void clearValueFlow();
 
     // cppcheck-suppress unusedFunction - used in tests only
     std::string astString(const char *sep = "") const {
@@ -1659,7 +1719,7 @@ public:
             ret = mImpl->mAstOperand1->astString(sep);
         if (mImpl->mAstOperand2)
             ret += mImpl->mAstOperand2->astString(sep);
-        return ret + sep + mStr;
+        return ret + sep + *mStr;
     }
 
     std::string astStringVerbose() const;
@@ -0,0 +1,129 @@
+/*
+ * Cppcheck - A tool for static C/C++ code analysis
+ * Copyright (C) 2007-2026 Cppcheck team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tokenarena.h"
+
+#include <cassert>
+#include <new>
+
+namespace {
+    /** Stored in front of every object so it can be deallocated without knowing the arena */
+    struct alignas(alignof(std::max_align_t)) Header {
+        TokenArena *arena;
+        std::size_t slotSize;
+    };
+
+    constexpr std::size_t slotsPerChunk = 1024;
+}
+
+void *TokenArena::allocate(std::size_t size, TokenArena *arena)
+{
+    // keep the following slots aligned
+    const std::size_t slotSize = (sizeof(Header) + size + alignof(Header) - 1) / alignof(Header) * alignof(Header);
+    Header *header;
+    if (arena)
+        header = static_cast<Header *>(arena->allocateSlot(slotSize));
+    else
+        header = static_cast<Header *>(::operator new(slotSize));
+    header->arena = arena;
+    header->slotSize = slotSize;
+    return header + 1;
+}
+
+void TokenArena::deallocate(void *p)
+{
+    if (!p)
+        return;
+    Header *header = static_cast<Header *>(p) - 1;
+    TokenArena *arena = header->arena;
+    if (!arena) {
+        ::operator delete(header);
+        return;
+    }
+    arena->deallocateSlot(header, header->slotSize);
+    if (arena->mReleased && arena->mSize == 0)
+        delete arena;
+}
+
+void TokenArena::release()
+{
+    mReleased = true;
+    if (mSize == 0)
+        delete this;
+}
+
+std::size_t TokenArena::chunks() const
+{
+    std::size_t count = 0;
+    for (const Pool &pool : mPools)
+        count += pool.chunks.size();
+    return count;
+}
+
+TokenArena::~TokenArena()
+{
+    for (const Pool &pool : mPools) {
+        for (char *chunk : pool.chunks)
+            ::operator delete(chunk);
+    }
+}
+
+void *TokenArena::allocateSlot(std::size_t slotSize)
+{
+    // there are only a few sizes (tokens and their implementation data)
+    Pool *pool = nullptr;
+    for (Pool &p : mPools) {
+        if (p.slotSize == slotSize) {
+            pool = &p;
+            break;
+        }
+    }
+    if (!pool) {
+        mPools.emplace_back(slotSize);
+        pool = &mPools.back();
+    }
+
+    ++mSize;
+    if (pool->freeList) {
+        void *slot = pool->freeList;
+        pool->freeList = *static_cast<void **>(slot);
+        return slot;
+    }
+    if (pool->next == pool->end) {
+        pool->chunks.push_back(static_cast<char *>(::operator new(slotSize * slotsPerChunk)));
+        pool->next = pool->chunks.back();
+        pool->end = pool->next + slotSize * slotsPerChunk;
+    }
+    void *slot = pool->next;
+    pool->next += slotSize;
+    return slot;
+}
+
+void TokenArena::deallocateSlot(void *slot, std::size_t slotSize)
+{
+    for (Pool &pool : mPools) {
+        if (pool.slotSize == slotSize) {
+            *static_cast<void **>(slot) = pool.freeList;
+            pool.freeList = slot;
+            assert(mSize > 0);
+            --mSize;
+            return;
+        }
+    }
+    assert(false);
+}
@@ -0,0 +1,97 @@
+/* -*- C++ -*-
+ * Cppcheck - A tool for static C/C++ code analysis
+ * Copyright (C) 2007-2026 Cppcheck team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+//---------------------------------------------------------------------------
+#ifndef tokenarenaH
+#define tokenarenaH
+//---------------------------------------------------------------------------
+
+#include "config.h"
+
+#include <cstddef>
+#include <vector>
+
+/// @addtogroup Core
+/// @{
+
+/**
+ * @brief Memory for the tokens of a TokenList and their implementation data.
+ *
+ * The memory is allocated in large chunks which are only freed when the arena is
+ * destroyed. The slots of deleted objects are reused for new objects of the same
+ * size. So the tokens of a list are mostly adjacent in memory and deleting a list
+ * does not free every token separately.
+ *
+ * The arena is owned by the TokensFrontBack of the list. It is destroyed when it
+ * has been released by its owner and all objects allocated in it have been
+ * deallocated. Not thread-safe.
+ */
+class CPPCHECKLIB TokenArena {
+public:
+    TokenArena() = default;
+
+    TokenArena(const TokenArena &) = delete;
+    TokenArena &operator=(const TokenArena &) = delete;
+
+    /**
+     * @brief Allocate memory for an object.
+     * @param size   the size of the object
+     * @param arena  the arena to allocate it in - the memory is allocated on the heap if it is nullptr
+     */
+    static void *allocate(std::size_t size, TokenArena *arena);
+
+    /** @brief Deallocate memory which has been allocated by allocate() */
+    static void deallocate(void *p);
+
+    /** @brief Called by the owner - the arena is destroyed once all objects have been deallocated */
+    void release();
+
+    /** number of allocated objects */
+    std::size_t size() const {
+        return mSize;
+    }
+
+    /** number of allocated chunks */
+    std::size_t chunks() const;
+
+private:
+    ~TokenArena();
+
+    /** Slots of a single size */
+    struct Pool {
+        explicit Pool(std::size_t slotSize) : slotSize(slotSize) {}
+
+        std::size_t slotSize;
+        std::vector<char *> chunks;
+        char *next{};
+        char *end{};
+        /** the slots which have been deallocated - each contains a pointer to the next one */
+        void *freeList{};
+    };
+
+    void *allocateSlot(std::size_t slotSize);
+    void deallocateSlot(void *slot, std::size_t slotSize);
+
+    std::vector<Pool> mPools;
+    std::size_t mSize{};
+    bool mReleased{};
+};
+
+/// @}
+//---------------------------------------------------------------------------
+#endif // tokenarenaH
@@ -0,0 +1,68 @@
+/*
+ * Cppcheck - A tool for static C/C++ code analysis
+ * Copyright (C) 2007-2026 Cppcheck team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tokenindex.h"
+
+#include "errortypes.h"
+#include "stringpool.h"
+
+#include <cassert>
+
+const std::array<const char *, 5> &TokenIndex::getIndexed()
+{
+    static const std::array<const char *, 5> indexed = {"asm", "goto", "template", "typedef", "using"};
+    return indexed;
+}
+
+int TokenIndex::find(const std::string *str)
+{
+    // the keywords are predefined so the interned strings can be compared by their address
+    static const std::array<const std::string *, 5> strings = [] {
+        std::array<const std::string *, 5> ret{};
+        for (std::size_t i = 0; i < ret.size(); ++i) {
+            ret[i] = StringPool::predefined(getIndexed()[i]);
+            assert(ret[i]);
+        }
+        return ret;
+    }();
+    for (std::size_t i = 0; i < strings.size(); ++i) {
+        if (strings[i] == str)
+            return static_cast<int>(i);
+    }
+    return -1;
+}
+
+void TokenIndex::update(Token *tok, const std::string *oldStr, const std::string *newStr)
+{
+    if (oldStr == newStr)
+        return;
+    const int oldPos = find(oldStr);
+    if (oldPos >= 0)
+        mTokens[oldPos].erase(tok);
+    const int newPos = find(newStr);
+    if (newPos >= 0)
+        mTokens[newPos].insert(tok);
+}
+
+const std::unordered_set<Token *> &TokenIndex::tokens(const std::string &str) const
+{
+    const int pos = find(StringPool::predefined(str));
+    if (pos < 0)
+        throw InternalError(nullptr, "Internal error. TokenIndex: '" + str + "' is not indexed.");
+    return mTokens[pos];
+}
@@ -0,0 +1,85 @@
+/* -*- C++ -*-
+ * Cppcheck - A tool for static C/C++ code analysis
+ * Copyright (C) 2007-2026 Cppcheck team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+//---------------------------------------------------------------------------
+#ifndef tokenindexH
+#define tokenindexH
+//---------------------------------------------------------------------------
+
+#include "config.h"
+
+#include <array>
+#include <cstddef>
+#include <string>
+#include <unordered_set>
+
+class Token;
+
+/// @addtogroup Core
+/// @{
+
+/**
+ * @brief The tokens of a TokenList with a rarely used keyword.
+ *
+ * Some passes only look at the tokens with a keyword like "typedef" or "template".
+ * They can use the index to skip a list without such tokens or to visit only them,
+ * instead of walking all tokens of the list.
+ *
+ * The index is owned by the TokensFrontBack of the list and is updated by the tokens
+ * of the list when their string changes or they are deleted. Only the keywords
+ * returned by getIndexed() are indexed. Not thread-safe.
+ */
+class CPPCHECKLIB TokenIndex {
+public:
+    TokenIndex() = default;
+
+    TokenIndex(const TokenIndex &) = delete;
+    TokenIndex &operator=(const TokenIndex &) = delete;
+
+    /** @brief The indexed keywords */
+    static const std::array<const char *, 5> &getIndexed();
+
+    /**
+     * @brief Update the index when the string of a token changes.
+     * @param tok     the token
+     * @param oldStr  the interned string of the token before the change
+     * @param newStr  the interned string of the token after the change - nullptr if the token is deleted
+     */
+    void update(Token *tok, const std::string *oldStr, const std::string *newStr);
+
+    /**
+     * @brief The tokens with the string in no particular order.
+     * @throws InternalError if the string is not indexed
+     */
+    const std::unordered_set<Token *> &tokens(const std::string &str) const;
+
+    /** @brief Is there a token with the string? */
+    bool contains(const std::string &str) const {
+        return !tokens(str).empty();
+    }
+
+private:
+    /** @return the position of the interned string in getIndexed() - -1 if it is not indexed */
+    static int find(const std::string *str);
+
+    std::array<std::unordered_set<Token *>, 5> mTokens;
+};
+
+/// @}
+//---------------------------------------------------------------------------
+#endif // tokenindexH
@@ -505,7 +505,7 @@ Token *Tokenizer::processFunc(Token *tok2, bool inOperator)
 
 void Tokenizer::simplifyTypedefLHS()
 {
-    if (!list.front())
+    if (!list.front() || !list.index().contains("typedef"))
         return;
 
     for (Token* tok = list.front()->next(); tok; tok = tok->next()) {
@@ -1070,6 +1070,9 @@ static bool matchCurrentType(const Token* tok, std::map<int, std::string>& types
 
 void Tokenizer::simplifyTypedef()
 {
+    if (!list.index().contains("typedef"))
+        return;
+
     // Simplify global typedefs that are not redefined with the fast 1-pass simplification.
     // Then use the slower old typedef simplification.
     std::map<std::string, std::set<std::string>> numberOfTypedefs;
@@ -2956,7 +2959,7 @@ static const Token* skipConstVolatileBackwards(const Token* tok) {
 
 bool Tokenizer::simplifyUsing()
 {
-    if (!isCPP())
+    if (!isCPP() || !list.index().contains("using"))
         return false;
 
     // simplify using N::x; to using x = N::x;
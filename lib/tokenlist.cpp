@@ -151,7 +151,7 @@ void TokenList::addtoken(const std::string& str, const nonneg int lineno, const
     if (mTokensFrontBack->back) {
         mTokensFrontBack->back->insertToken(str);
     } else {
-        mTokensFrontBack->front = new Token(*this, mTokensFrontBack);
+        mTokensFrontBack->front = new (*mTokensFrontBack->arena) Token(*this, mTokensFrontBack);
         mTokensFrontBack->back = mTokensFrontBack->front;
         mTokensFrontBack->back->str(str);
     }
@@ -169,7 +169,7 @@ void TokenList::addtoken(const std::string& str, const Token *locationTok)
     if (mTokensFrontBack->back) {
         mTokensFrontBack->back->insertToken(str);
     } else {
-        mTokensFrontBack->front = new Token(*this, mTokensFrontBack);
+        mTokensFrontBack->front = new (*mTokensFrontBack->arena) Token(*this, mTokensFrontBack);
         mTokensFrontBack->back = mTokensFrontBack->front;
         mTokensFrontBack->back->str(str);
     }
@@ -187,7 +187,7 @@ void TokenList::addtoken(const Token * tok, const nonneg int lineno, const nonne
     if (mTokensFrontBack->back) {
         mTokensFrontBack->back->insertToken(tok->str(), tok->originalName());
     } else {
-        mTokensFrontBack->front = new Token(*this, mTokensFrontBack);
+        mTokensFrontBack->front = new (*mTokensFrontBack->arena) Token(*this, mTokensFrontBack);
         mTokensFrontBack->back = mTokensFrontBack->front;
         mTokensFrontBack->back->str(tok->str());
         if (!tok->originalName().empty())
@@ -209,7 +209,7 @@ void TokenList::addtoken(const Token *tok, const Token *locationTok)
     if (mTokensFrontBack->back) {
         mTokensFrontBack->back->insertToken(tok->str(), tok->originalName());
     } else {
-        mTokensFrontBack->front = new Token(*this, mTokensFrontBack);
+        mTokensFrontBack->front = new (*mTokensFrontBack->arena) Token(*this, mTokensFrontBack);
         mTokensFrontBack->back = mTokensFrontBack->front;
         mTokensFrontBack->back->str(tok->str());
         if (!tok->originalName().empty())
@@ -231,7 +231,7 @@ void TokenList::addtoken(const Token *tok)
     if (mTokensFrontBack->back) {
         mTokensFrontBack->back->insertToken(tok->str(), tok->originalName(), tok->getMacroName());
     } else {
-        mTokensFrontBack->front = new Token(*this, mTokensFrontBack);
+        mTokensFrontBack->front = new (*mTokensFrontBack->arena) Token(*this, mTokensFrontBack);
         mTokensFrontBack->back = mTokensFrontBack->front;
         mTokensFrontBack->back->str(tok->str());
         if (!tok->originalName().empty())
@@ -391,7 +391,7 @@ void TokenList::createTokens(simplecpp::TokenList&& tokenList)
         if (mTokensFrontBack->back) {
             mTokensFrontBack->back->insertToken(str);
         } else {
-            mTokensFrontBack->front = new Token(*this, mTokensFrontBack);
+            mTokensFrontBack->front = new (*mTokensFrontBack->arena) Token(*this, mTokensFrontBack);
             mTokensFrontBack->back = mTokensFrontBack->front;
             mTokensFrontBack->back->str(str);
         }
@@ -23,6 +23,9 @@
 
 #include "config.h"
 #include "standards.h"
+#include "stringpool.h"
+#include "tokenarena.h"
+#include "tokenindex.h"
 
 #include <cstddef>
 #include <cstdint>
@@ -44,8 +47,22 @@ namespace simplecpp {
  * @brief This struct stores pointers to the front and back tokens of the list this token is in.
  */
 struct TokensFrontBack {
+    TokensFrontBack() : arena(new TokenArena) {}
+    ~TokensFrontBack() {
+        arena->release();
+    }
+
+    TokensFrontBack(const TokensFrontBack &) = delete;
+    TokensFrontBack &operator=(const TokensFrontBack &) = delete;
+
     Token *front{};
     Token* back{};
+    /** the memory for the tokens of the list */
+    TokenArena * const arena;
+    /** the strings of the tokens of the list */
+    StringPool strings;
+    /** the tokens of the list with a rarely used keyword */
+    TokenIndex index;
 };
 
 class CPPCHECKLIB TokenList {
@@ -135,6 +152,11 @@ public:
         return mTokensFrontBack->back;
     }
 
+    /** get the tokens with a rarely used keyword */
+    const TokenIndex &index() const {
+        return mTokensFrontBack->index;
+    }
+
     /**
      * Get filenames (the sourcefile + the files it include).
      * The first filename is the filename for the sourcefile
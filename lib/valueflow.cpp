@@ -159,6 +159,11 @@ static void bailoutInternal(const std::string& type,
 #define bailoutIncompleteVar(tokenlist, errorLogger, tok, what)                                                        \
     bailoutInternal("valueFlowBailoutIncompleteVar", (tokenlist), (errorLogger), (tok), (what), "", 0, __func__)
 
+static std::list<ValueFlow::Value> toList(const ValueFlow::ValueList& values)
+{
+    return {values.cbegin(), values.cend()};
+}
+
 static void changeKnownToPossible(std::list<ValueFlow::Value>& values, int indirect = -1)
 {
     for (ValueFlow::Value& v : values) {
@@ -1989,7 +1994,7 @@ static void valueFlowForwardLifetime(Token * tok, const TokenList &tokenlist, Er
 {
     // Forward lifetimes to constructed variable
     if (Token::Match(tok->previous(), "%var% {|(") && isVariableDecl(tok->previous())) {
-        std::list<ValueFlow::Value> values = tok->values();
+        std::list<ValueFlow::Value> values = toList(tok->values());
         values.remove_if(&isNotLifetimeValue);
         valueFlowForward(nextAfterAstRightmostLeaf(tok), ValueFlow::getEndOfExprScope(tok), tok->previous(), std::move(values), tokenlist, errorLogger, settings);
         return;
@@ -2018,7 +2023,7 @@ static void valueFlowForwardLifetime(Token * tok, const TokenList &tokenlist, Er
         const Token* endOfVarScope = ValueFlow::getEndOfExprScope(expr);
 
         // Only forward lifetime values
-        std::list<ValueFlow::Value> values = parent->astOperand2()->values();
+        std::list<ValueFlow::Value> values = toList(parent->astOperand2()->values());
         values.remove_if(&isNotLifetimeValue);
         // Dont forward lifetimes that overlap
         values.remove_if([&](const ValueFlow::Value& value) {
@@ -2053,14 +2058,14 @@ static void valueFlowForwardLifetime(Token * tok, const TokenList &tokenlist, Er
         const Variable *var = tok->variable();
         const Token *endOfVarScope = var->scope()->bodyEnd;
 
-        std::list<ValueFlow::Value> values = tok->values();
+        std::list<ValueFlow::Value> values = toList(tok->values());
         Token *nextExpression = nextAfterAstRightmostLeaf(parent);
         // Only forward lifetime values
         values.remove_if(&isNotLifetimeValue);
         valueFlowForward(nextExpression, endOfVarScope, tok, std::move(values), tokenlist, errorLogger, settings);
         // Cast
     } else if (parent->isCast()) {
-        std::list<ValueFlow::Value> values = tok->values();
+        std::list<ValueFlow::Value> values = toList(tok->values());
         // Only forward lifetime values
         values.remove_if(&isNotLifetimeValue);
         for (ValueFlow::Value& value:values)
@@ -4207,7 +4212,7 @@ static void valueFlowAfterAssign(const TokenList &tokenlist,
                 continue;
 
             std::list<ValueFlow::Value> values = truncateValues(
-                rhs->values(), tok->astOperand1()->valueType(), rhs->valueType(), settings);
+                toList(rhs->values()), tok->astOperand1()->valueType(), rhs->valueType(), settings);
             // Remove known values
             std::set<ValueFlow::Value::ValueType> types;
             if (tok->astOperand1()->hasKnownValue()) {
@@ -4337,7 +4342,7 @@ static void valueFlowAfterSwap(const TokenList& tokenlist,
                 continue;
             for (int i = 0; i < 2; i++) {
                 std::vector<const Variable*> vars = getVariables(args[0]);
-                const std::list<ValueFlow::Value>& values = args[0]->values();
+                const std::list<ValueFlow::Value> values = toList(args[0]->values());
                 valueFlowForwardAssign(args[0], args[1], std::move(vars), values, false, tokenlist, errorLogger, settings);
                 std::swap(args[0], args[1]);
             }
@@ -5697,7 +5702,7 @@ static void valueFlowSwitchVariable(const TokenList& tokenlist,
 
 static std::list<ValueFlow::Value> getFunctionArgumentValues(const Token* argtok)
 {
-    std::list<ValueFlow::Value> argvalues(argtok->values());
+    std::list<ValueFlow::Value> argvalues = toList(argtok->values());
     removeImpossible(argvalues);
     if (argvalues.empty() && Token::Match(argtok, "%comp%|%oror%|&&|!")) {
         argvalues.emplace_back(0);
@@ -5830,7 +5835,7 @@ static void valueFlowFunctionDefaultParameter(const TokenList& tokenlist, const
         for (size_t arg = function->minArgCount(); arg < function->argCount(); arg++) {
             const Variable* var = function->getArgumentVar(arg);
             if (var && var->hasDefault() && Token::Match(var->nameToken(), "%var% = %num%|%str%|%char%|%name% [,)]")) {
-                const std::list<ValueFlow::Value> &values = var->nameToken()->tokAt(2)->values();
+                const ValueFlow::ValueList &values = var->nameToken()->tokAt(2)->values();
                 std::list<ValueFlow::Value> argvalues;
                 for (const ValueFlow::Value &value : values) {
                     if (!value.isKnown())
@@ -6146,7 +6151,7 @@ static void valueFlowUninit(TokenList& tokenlist, ErrorLogger& errorLogger, cons
                             continue;
                         addToErrorPath(v2, v);
                     }
-                    v2.subexpressions.push_back(memVar.nameToken()->str());
+                    v2.addSubexpression(memVar.nameToken()->str());
                 }
             }
         }
@@ -6374,7 +6379,7 @@ static void valueFlowSmartPointer(TokenList &tokenlist, ErrorLogger & errorLogge
                 if (Token::Match(tok, "%var% (|{") && tok->next()->astOperand2() &&
                     tok->next()->astOperand2()->str() != ",") {
                     Token* inTok = tok->next()->astOperand2();
-                    const std::list<ValueFlow::Value>& values = inTok->values();
+                    const std::list<ValueFlow::Value> values = toList(inTok->values());
                     const bool constValue = inTok->isNumber();
                     valueFlowForwardAssign(inTok, var, values, constValue, true, tokenlist, errorLogger, settings);
 
@@ -6398,7 +6403,7 @@ static void valueFlowSmartPointer(TokenList &tokenlist, ErrorLogger & errorLogge
                     Token* inTok = ftok->astOperand2();
                     if (!inTok)
                         continue;
-                    const std::list<ValueFlow::Value>& values = inTok->values();
+                    const std::list<ValueFlow::Value> values = toList(inTok->values());
                     valueFlowForwardAssign(inTok, tok, std::move(vars), values, false, tokenlist, errorLogger, settings);
                 }
             } else if (Token::simpleMatch(tok->astParent(), ". release ( )")) {
@@ -6477,15 +6482,16 @@ static void valueFlowIterators(TokenList& tokenlist, const Settings& settings)
     }
 }
 
-static std::list<ValueFlow::Value> getIteratorValues(std::list<ValueFlow::Value> values,
+static std::list<ValueFlow::Value> getIteratorValues(const ValueFlow::ValueList& values,
                                                      const ValueFlow::Value::ValueKind* kind = nullptr)
 {
-    values.remove_if([&](const ValueFlow::Value& v) {
+    std::list<ValueFlow::Value> result;
+    std::copy_if(values.cbegin(), values.cend(), std::back_inserter(result), [&](const ValueFlow::Value& v) {
         if (kind && v.valueKind != *kind)
-            return true;
-        return !v.isIteratorValue();
+            return false;
+        return v.isIteratorValue();
     });
-    return values;
+    return result;
 }
 
 struct IteratorConditionHandler : SimpleConditionHandler {
@@ -7578,7 +7584,7 @@ std::string ValueFlow::eitherTheConditionIsRedundant(const Token *condition)
     return "Either the condition '" + condition->expressionString() + "' is redundant";
 }
 
-const ValueFlow::Value* ValueFlow::findValue(const std::list<ValueFlow::Value>& values,
+const ValueFlow::Value* ValueFlow::findValue(const ValueFlow::ValueList& values,
                                              const Settings& settings,
                                              const std::function<bool(const ValueFlow::Value&)> &pred)
 {
@@ -58,7 +58,7 @@ namespace ValueFlow {
 
     std::string eitherTheConditionIsRedundant(const Token *condition);
 
-    const Value* findValue(const std::list<Value>& values,
+    const Value* findValue(const ValueList& values,
                            const Settings& settings,
                            const std::function<bool(const Value&)> &pred);
 
@@ -368,9 +368,9 @@ namespace ValueFlow
                 setTokenValue(parent, std::move(value), settings);
                 return;
             }
-            if (!value.subexpressions.empty() && Token::Match(parent, ". %var%")) {
-                if (contains(value.subexpressions, parent->strAt(1)))
-                    value.subexpressions.clear();
+            if (value.subexpressions && Token::Match(parent, ". %var%")) {
+                if (contains(*value.subexpressions, parent->strAt(1)))
+                    value.subexpressions.reset();
                 else
                     return;
             }
@@ -421,7 +421,7 @@ namespace ValueFlow
                     const Token *op = cond ? tok->astOperand1() : tok->astOperand2();
                     if (!op) // #7769 segmentation fault at setTokenValue()
                         return;
-                    const std::list<Value> &values = op->values();
+                    const ValueList &values = op->values();
                     if (std::find(values.cbegin(), values.cend(), value) != values.cend())
                         setTokenValue(parent, std::move(value), settings);
                 }
@@ -451,7 +451,7 @@ namespace ValueFlow
 
         else if (parent->str() == "?" && value.isIntValue() && tok == parent->astOperand1() && value.isKnown() &&
                  parent->astOperand2() && parent->astOperand2()->astOperand1() && parent->astOperand2()->astOperand2()) {
-            const std::list<Value> &values = (value.intvalue == 0
+            const ValueList &values = (value.intvalue == 0
                 ? parent->astOperand2()->astOperand2()->values()
                 : parent->astOperand2()->astOperand1()->values());
 
@@ -22,8 +22,15 @@
 #include "token.h"
 #include "utils.h"
 
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
 #include <sstream>
 #include <string>
+#include <utility>
+#include <vector>
 
 namespace ValueFlow {
     Value::Value(const Token *c, MathLib::bigint val, Bound b)
@@ -43,6 +50,12 @@ namespace ValueFlow {
         errorPath.emplace_back(tok, "Assuming that condition '" + tok->expressionString() + "' is not redundant");
     }
 
+    void Value::addSubexpression(std::string s) {
+        auto newSubexpressions = subexpressions ? std::make_shared<std::vector<std::string>>(*subexpressions) : std::make_shared<std::vector<std::string>>();
+        newSubexpressions->push_back(std::move(s));
+        subexpressions = std::move(newSubexpressions);
+    }
+
     std::string Value::toString() const {
         std::stringstream ss;
         if (this->isImpossible())
@@ -197,4 +210,100 @@ namespace ValueFlow {
         }
         return "";
     }
+
+    ValueList::ValueList(const ValueList &other)
+    {
+        *this = other;
+    }
+
+    ValueList::ValueList(ValueList &&other) noexcept
+    {
+        *this = std::move(other);
+    }
+
+    ValueList::~ValueList()
+    {
+        release();
+    }
+
+    ValueList &ValueList::operator=(const ValueList &other)
+    {
+        if (this == &other)
+            return *this;
+        clear();
+        if (other.mSize > mCapacity)
+            grow(other.mSize);
+        for (const Value &v : other)
+            emplace_back(v);
+        return *this;
+    }
+
+    ValueList &ValueList::operator=(ValueList &&other) noexcept
+    {
+        if (this == &other)
+            return *this;
+        release();
+        if (other.isInline()) {
+            for (Value &v : other)
+                emplace_back(std::move(v));
+            other.clear();
+        } else {
+            // take over the allocated values
+            mData = other.mData;
+            mSize = other.mSize;
+            mCapacity = other.mCapacity;
+            other.mData = reinterpret_cast<Value *>(other.mInline);
+            other.mSize = 0;
+            other.mCapacity = InlineCapacity;
+        }
+        return *this;
+    }
+
+    ValueList::iterator ValueList::insert(const_iterator pos, Value v)
+    {
+        const std::size_t index = pos - mData;
+        emplace_back(std::move(v));
+        std::rotate(mData + index, mData + mSize - 1, mData + mSize);
+        return mData + index;
+    }
+
+    ValueList::iterator ValueList::erase(const_iterator first, const_iterator last)
+    {
+        const std::size_t index = first - mData;
+        const std::size_t count = last - first;
+        if (count == 0)
+            return mData + index;
+        std::move(mData + index + count, mData + mSize, mData + index);
+        for (std::size_t i = mSize - count; i < mSize; ++i)
+            mData[i].~Value();
+        mSize -= static_cast<std::uint32_t>(count);
+        return mData + index;
+    }
+
+    void ValueList::grow(size_type minCapacity)
+    {
+        size_type capacity = 2 * mCapacity;
+        if (capacity < minCapacity)
+            capacity = minCapacity;
+        auto *data = static_cast<Value *>(::operator new(capacity * sizeof(Value)));
+        for (std::size_t i = 0; i < mSize; ++i) {
+            new (data + i) Value(std::move(mData[i]));
+            mData[i].~Value();
+        }
+        if (!isInline())
+            ::operator delete(mData);
+        mData = data;
+        mCapacity = static_cast<std::uint32_t>(capacity);
+    }
+
+    /** destroy the values and free the allocated memory - the list is empty and inline afterwards */
+    void ValueList::release()
+    {
+        clear();
+        if (!isInline()) {
+            ::operator delete(mData);
+            mData = reinterpret_cast<Value *>(mInline);
+            mCapacity = InlineCapacity;
+        }
+    }
 }
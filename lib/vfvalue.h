@@ -25,10 +25,15 @@
 #include "errortypes.h"
 #include "mathlib.h"
 
+#include <algorithm>
 #include <cassert>
 #include <cmath>
+#include <cstddef>
 #include <cstdint>
 #include <functional>
+#include <initializer_list>
+#include <memory>
+#include <new>
 #include <string>
 #include <type_traits>
 #include <utility>
@@ -358,7 +363,11 @@ namespace ValueFlow
         /** int value before implicit truncation */
         MathLib::bigint wideintvalue{};
 
-        std::vector<std::string> subexpressions;
+        /** the members of a struct which are uninitialized - shared by the copies of the value, nullptr if there are none */
+        std::shared_ptr<const std::vector<std::string>> subexpressions;
+
+        /** add a member to the subexpressions - the other values sharing them are not changed */
+        void addSubexpression(std::string s);
 
         // Set to where a lifetime is captured by value
         const Token* capturetok{};
@@ -433,6 +442,129 @@ namespace ValueFlow
             }
         };
     };
+
+    /**
+     * @brief The values of a token.
+     *
+     * The values are stored contiguously. The first values are stored in the list
+     * itself so most tokens with values need no further allocation.
+     */
+    class CPPCHECKLIB ValueList {
+    public:
+        using value_type = Value;
+        using size_type = std::size_t;
+        using reference = Value&;
+        using const_reference = const Value&;
+        using iterator = Value*;
+        using const_iterator = const Value*;
+
+        ValueList() = default;
+        ValueList(const ValueList &other);
+        ValueList(ValueList &&other) noexcept;
+        ValueList(std::initializer_list<Value> values) : ValueList(values.begin(), values.end()) {}
+        template<class Iterator>
+        ValueList(Iterator first, Iterator last) {
+            for (; first != last; ++first)
+                push_back(*first);
+        }
+        ~ValueList();
+
+        ValueList &operator=(const ValueList &other);
+        ValueList &operator=(ValueList &&other) noexcept;
+
+        iterator begin() {
+            return mData;
+        }
+        iterator end() {
+            return mData + mSize;
+        }
+        const_iterator begin() const {
+            return mData;
+        }
+        const_iterator end() const {
+            return mData + mSize;
+        }
+        const_iterator cbegin() const {
+            return mData;
+        }
+        const_iterator cend() const {
+            return mData + mSize;
+        }
+
+        bool empty() const {
+            return mSize == 0;
+        }
+        size_type size() const {
+            return mSize;
+        }
+
+        Value &front() {
+            assert(mSize > 0);
+            return mData[0];
+        }
+        const Value &front() const {
+            assert(mSize > 0);
+            return mData[0];
+        }
+        Value &back() {
+            assert(mSize > 0);
+            return mData[mSize - 1];
+        }
+        const Value &back() const {
+            assert(mSize > 0);
+            return mData[mSize - 1];
+        }
+
+        template<class ... Ts>
+        Value &emplace_back(Ts&&... ts) {
+            if (mSize == mCapacity)
+                grow(mSize + 1);
+            Value *v = new (mData + mSize) Value(std::forward<Ts>(ts)...);
+            ++mSize;
+            return *v;
+        }
+        void push_back(const Value &v) {
+            emplace_back(v);
+        }
+        void push_back(Value &&v) {
+            emplace_back(std::move(v));
+        }
+        void push_front(Value v) {
+            insert(cbegin(), std::move(v));
+        }
+        iterator insert(const_iterator pos, Value v);
+
+        iterator erase(const_iterator pos) {
+            return erase(pos, pos + 1);
+        }
+        iterator erase(const_iterator first, const_iterator last);
+
+        /** remove the values matching the predicate - the order of the other values is kept */
+        template<class Predicate>
+        void remove_if(Predicate pred) {
+            erase(std::remove_if(begin(), end(), std::move(pred)), end());
+        }
+
+        void clear() {
+            erase(cbegin(), cend());
+        }
+
+    private:
+        /** number of values stored in the list itself */
+        static constexpr size_type InlineCapacity = 2;
+
+        bool isInline() const {
+            return mData == reinterpret_cast<const Value *>(mInline);
+        }
+
+        void grow(size_type minCapacity);
+        void release();
+
+        Value *mData{reinterpret_cast<Value *>(mInline)};
+        std::uint32_t mSize{};
+        std::uint32_t mCapacity{InlineCapacity};
+        alignas(Value) unsigned char mInline[InlineCapacity * sizeof(Value)];
+    };
 }
 
 FORCE_WARNING_CLANG_POP
@@ -2307,6 +2307,7 @@ void f(bool b)
         '--enable=warning',  # to execute the code which generates the normalCheckLevelMaxBranches message
         '--enable=information',  # to show the normalCheckLevelMaxBranches message
         '--cppcheck-build-dir={}'.format(build_dir),
+        '--debug-analyzerinfo',  # to export the analyzer information as XML
         '--template=simple',
         str(test_file)
     ]
@@ -2315,7 +2316,7 @@ void f(bool b)
     assert exitcode == 0, stdout
     assert stderr == '{}:0:0: information: Limiting analysis of branches. Use --check-level=exhaustive to analyze all branches. [normalCheckLevelMaxBranches]\n'.format(test_file)
 
-    cache_file = (build_dir / 'test.a1')
+    cache_file = (build_dir / 'test.a1.xml')
 
     root = ElementTree.fromstring(cache_file.read_text())
     hash_1 = root.get('hash')
@@ -4494,7 +4495,14 @@ def test_analyzerinfo(tmp_path):
 
     # cached results
     run_and_assert_cppcheck([
-        "skipping analysis - loaded 1 cached finding(s) from '{}' for '{}'".format(test_a1_file_s, test_file_s)
+        "skipping analysis - loaded 1 cached finding(s) from '{}' for '{}' - no file has changed".format(test_a1_file_s, test_file_s)
+    ])
+
+    # touched file
+    os.utime(test_file, (0, 0))
+
+    run_and_assert_cppcheck([
+        "skipping analysis - loaded 1 cached finding(s) from '{}' for '{}' - no file has changed".format(test_a1_file_s, test_file_s)
     ])
 
     # modified file
@@ -4502,49 +4510,48 @@ def test_analyzerinfo(tmp_path):
         f.write('\n#define DEF')
 
     run_and_assert_cppcheck([
+        "cached result '{}' for '{}' is outdated - '{}' has changed".format(test_a1_file_s, test_file_s, test_file_s),
         "discarding cached result from '{}' for '{}' - hash mismatch".format(test_a1_file_s, test_file_s)
     ])
 
-    # invalid XML
-    with open(test_a1_file, 'a') as f:
-        f.write('.')
+    # changed options
+    args.insert(0, '--std=c99')
 
     run_and_assert_cppcheck([
-        "discarding cached result - failed to load '{}' for '{}' (XML_ERROR_PARSING_TEXT)".format(test_a1_file_s, test_file_s)
-    ])
-
-    # missing root node
-    with open(test_a1_file, 'w') as f:
-        f.write('<?xml version="1.0"?>')
-
-    run_and_assert_cppcheck([
-        "discarding cached result from '{}' for '{}' - no root node found".format(test_a1_file_s, test_file_s)
+        "cached result '{}' for '{}' is outdated - the options have changed".format(test_a1_file_s, test_file_s),
+        "skipping analysis - loaded 1 cached finding(s) from '{}' for '{}'".format(test_a1_file_s, test_file_s)
     ])
 
-    # mismatched root node
-    with open(test_a1_file, 'w') as f:
-        f.write('<?xml version="1.0"?><root/>')
+    # truncated file
+    with open(test_a1_file, 'r+b') as f:
+        f.truncate(30)
 
     run_and_assert_cppcheck([
-        "discarding cached result from '{}' for '{}' - unexpected root node".format(test_a1_file_s, test_file_s)
+        "discarding cached result from '{}' for '{}' - truncated index".format(test_a1_file_s, test_file_s)
     ])
 
-    # missing 'hash' attribute
-    with open(test_a1_file, 'w') as f:
-        f.write('<?xml version="1.0"?><analyzerinfo/>')
+    # empty file
+    with open(test_a1_file, 'w'):
+        pass
 
     run_and_assert_cppcheck([
-        "discarding cached result from '{}' for '{}' - no 'hash' attribute found".format(test_a1_file_s, test_file_s)
+        "discarding cached result from '{}' for '{}' - not an analyzer information file".format(test_a1_file_s, test_file_s)
     ])
 
-    # invalid 'hash' attribute
+    # XML file from an older version
     with open(test_a1_file, 'w') as f:
         f.write('<?xml version="1.0"?><analyzerinfo hash="hash"/>')
 
     run_and_assert_cppcheck([
-        "discarding cached result from '{}' for '{}' - hash mismatch".format(test_a1_file_s, test_file_s)
+        "discarding cached result from '{}' for '{}' - not an analyzer information file".format(test_a1_file_s, test_file_s)
     ])
 
+    # XML export
+    analyzerinfo = ElementTree.fromstring((build_dir / 'test.a1.xml').read_text())
+    assert analyzerinfo.tag == 'analyzerinfo'
+    assert analyzerinfo.get('hash')
+    assert [e.get('id') for e in analyzerinfo.findall('error')] == ['nullPointer']
+
     # TODO:
     # - invalid error
     # - internalError
@@ -4573,13 +4580,14 @@ void f(T* p)
         '-q',
         '--template=simple',
         '--cppcheck-build-dir={}'.format(build_dir),
+        '--debug-analyzerinfo',  # to export the analyzer information as XML
         str(test_file)
     ]
 
     exitcode, _, _ = cppcheck(args)
     assert exitcode == 0
 
-    test_a1_file = build_dir / 'test.a1'
+    test_a1_file = build_dir / 'test.a1.xml'
     analyzerinfo = ElementTree.fromstring(test_a1_file.read_text())
     function_call_paths = analyzerinfo.findall('FileInfo/function-call/path')
     assert len(function_call_paths) == 1
@@ -80,7 +80,7 @@ def test_build_dir_hash_cppcheck_product(tmpdir):
         f.write(';')
 
     build_dir = tmpdir.mkdir('b')
-    args = [f'--cppcheck-build-dir={build_dir}', test_file]
+    args = [f'--cppcheck-build-dir={build_dir}', '--debug-analyzerinfo', test_file]
 
     exitcode, stdout, stderr = cppcheck(args)
     assert 'error' not in stdout
@@ -94,7 +94,7 @@ def test_build_dir_hash_cppcheck_product(tmpdir):
         i += 7
         return s[i:s.find('"', i)]
 
-    with open(build_dir.join('test.a1'), 'rt') as f:
+    with open(build_dir.join('test.a1.xml'), 'rt') as f:
         f1 = f.read()
         hash1 = _get_hash(f1)
     assert re.match(r'^[0-9a-f]{6,}$', hash1), f1
@@ -105,7 +105,7 @@ def test_build_dir_hash_cppcheck_product(tmpdir):
     assert stderr == ''
     assert exitcode == 0
 
-    with open(build_dir.join('test.a1'), 'rt') as f:
+    with open(build_dir.join('test.a1.xml'), 'rt') as f:
         f2 = f.read()
         hash2 = _get_hash(f2)
     assert re.match(r'^[0-9a-f]{6,}$', hash2), f2
@@ -21,10 +21,17 @@
 #include "errorlogger.h"
 #include "filesettings.h"
 #include "fixture.h"
+#include "helpers.h"
+#include "path.h"
 #include "standards.h"
+#include "utils.h"
 
+#include <cstdio>
+#include <fstream>
 #include <list>
 #include <sstream>
+#include <string>
+#include <vector>
 
 #include "xml.h"
 
@@ -45,6 +52,11 @@ private:
         TEST_CASE(filesTextDuplicateFile);
         TEST_CASE(parse);
         TEST_CASE(skipAnalysis);
+        TEST_CASE(writeAndRead);
+        TEST_CASE(cacheFile);
+        TEST_CASE(cacheDir);
+        TEST_CASE(dependencies);
+        TEST_CASE(timingsTxt);
     }
 
     void getAnalyzerInfoFileFromFilesTxt() const {
@@ -110,164 +122,356 @@ private:
         ASSERT_EQUALS("C:/dm/cppcheck-fix-13333/test/cli/whole-program/odr1.cpp", info.sourceFile);
     }
 
+    static std::string getAnalyzerInfo(std::size_t hash, const char errorXml[]) {
+        std::vector<AnalyzerInformationTest::Entry> entries;
+        if (errorXml) {
+            tinyxml2::XMLDocument doc;
+            doc.Parse(errorXml);
+            const ErrorMessage msg(doc.FirstChildElement());
+            entries.push_back({'E', msg.id, msg.serialize()});
+        }
+        return AnalyzerInformationTest::serialize(hash, entries);
+    }
+
     void skipAnalysis() const {
         // Matching hash with license error (don't skip)
         {
             std::list<ErrorMessage> errorList;
-            tinyxml2::XMLDocument doc;
+            const std::string data = getAnalyzerInfo(100,
+                                                     "<error id=\"premium-invalidLicense\" severity=\"error\" msg=\"Invalid license: No license file was found, contact sales@cppchecksolutions.com\" verbose=\"Invalid license: No license file was found, contact sales@cppchecksolutions.com\" file0=\"test.c\">"
+                                                     "<location file=\"Cppcheck Premium\" line=\"0\" column=\"0\"/>"
+                                                     "</error>");
 
-            const tinyxml2::XMLError xmlError = doc.Parse(
-                "<?xml version=\"1.0\"?>"
-                "<analyzerinfo hash=\"100\">"
-                "<error id=\"premium-invalidLicense\" severity=\"error\" msg=\"Invalid license: No license file was found, contact sales@cppchecksolutions.com\" verbose=\"Invalid license: No license file was found, contact sales@cppchecksolutions.com\" file0=\"test.c\">"
-                "<location file=\"Cppcheck Premium\" line=\"0\" column=\"0\"/>"
-                "</error>"
-                "</analyzerinfo>"
-                );
-            ASSERT_EQUALS(tinyxml2::XML_SUCCESS, xmlError);
-
-            ASSERT_EQUALS("'premium-invalidLicense' encountered", AnalyzerInformationTest::skipAnalysis(doc, 100, errorList));
+            ASSERT_EQUALS("'premium-invalidLicense' encountered", AnalyzerInformationTest::skipAnalysis(data.data(), data.size(), 100, errorList));
             ASSERT_EQUALS(0, errorList.size());
         }
 
         // Matching hash with premium internal error (don't skip)
         {
             std::list<ErrorMessage> errorList;
-            tinyxml2::XMLDocument doc;
+            const std::string data = getAnalyzerInfo(100,
+                                                     "<error id=\"premium-internalError\" severity=\"error\" msg=\"Something went wrong\" verbose=\"Something went wrong\" file0=\"test.c\">"
+                                                     "<location file=\"Cppcheck\" line=\"0\" column=\"0\"/>"
+                                                     "</error>");
 
-            const tinyxml2::XMLError xmlError = doc.Parse(
-                "<?xml version=\"1.0\"?>"
-                "<analyzerinfo hash=\"100\">"
-                "<error id=\"premium-internalError\" severity=\"error\" msg=\"Something went wrong\" verbose=\"Something went wrong\" file0=\"test.c\">"
-                "<location file=\"Cppcheck\" line=\"0\" column=\"0\"/>"
-                "</error>"
-                "</analyzerinfo>"
-                );
-            ASSERT_EQUALS(tinyxml2::XML_SUCCESS, xmlError);
-
-            ASSERT_EQUALS("'premium-internalError' encountered", AnalyzerInformationTest::skipAnalysis(doc, 100, errorList));
+            ASSERT_EQUALS("'premium-internalError' encountered", AnalyzerInformationTest::skipAnalysis(data.data(), data.size(), 100, errorList));
             ASSERT_EQUALS(0, errorList.size());
         }
 
         // Matching hash with internal error (don't skip)
         {
             std::list<ErrorMessage> errorList;
-            tinyxml2::XMLDocument doc;
+            const std::string data = getAnalyzerInfo(100,
+                                                     "<error id=\"internalError\" severity=\"error\" msg=\"Something went wrong\" verbose=\"Something went wrong\" file0=\"test.c\">"
+                                                     "<location file=\"Cppcheck\" line=\"0\" column=\"0\"/>"
+                                                     "</error>");
 
-            const tinyxml2::XMLError xmlError = doc.Parse(
-                "<?xml version=\"1.0\"?>"
-                "<analyzerinfo hash=\"100\">"
-                "<error id=\"internalError\" severity=\"error\" msg=\"Something went wrong\" verbose=\"Something went wrong\" file0=\"test.c\">"
-                "<location file=\"Cppcheck\" line=\"0\" column=\"0\"/>"
-                "</error>"
-                "</analyzerinfo>"
-                );
-            ASSERT_EQUALS(tinyxml2::XML_SUCCESS, xmlError);
-
-            ASSERT_EQUALS("'internalError' encountered", AnalyzerInformationTest::skipAnalysis(doc, 100, errorList));
+            ASSERT_EQUALS("'internalError' encountered", AnalyzerInformationTest::skipAnalysis(data.data(), data.size(), 100, errorList));
             ASSERT_EQUALS(0, errorList.size());
         }
 
         // Matching hash with normal error (skip)
         {
             std::list<ErrorMessage> errorList;
-            tinyxml2::XMLDocument doc;
-
-            const tinyxml2::XMLError xmlError = doc.Parse(
-                "<?xml version=\"1.0\"?>"
-                "<analyzerinfo hash=\"100\">"
-                "<error id=\"nullPointer\" severity=\"error\" msg=\"Null pointer dereference: ptr\" verbose=\"Null pointer dereference: ptr\" cwe=\"476\" file0=\"test.c\">"
-                "<location file=\"test.c\" line=\"4\" column=\"3\" info=\"Null pointer dereference\"/>"
-                "<location file=\"test.c\" line=\"3\" column=\"12\" info=\"Assignment &apos;ptr=NULL&apos;, assigned value is 0\"/>"
-                "<symbol>ptr</symbol>"
-                "</error>"
-                "</analyzerinfo>"
-                );
-            ASSERT_EQUALS(tinyxml2::XML_SUCCESS, xmlError);
-
-            ASSERT_EQUALS("", AnalyzerInformationTest::skipAnalysis(doc, 100, errorList));
+            const std::string data = getAnalyzerInfo(100,
+                                                     "<error id=\"nullPointer\" severity=\"error\" msg=\"Null pointer dereference: ptr\" verbose=\"Null pointer dereference: ptr\" cwe=\"476\" file0=\"test.c\">"
+                                                     "<location file=\"test.c\" line=\"4\" column=\"3\" info=\"Null pointer dereference\"/>"
+                                                     "<location file=\"test.c\" line=\"3\" column=\"12\" info=\"Assignment &apos;ptr=NULL&apos;, assigned value is 0\"/>"
+                                                     "<symbol>ptr</symbol>"
+                                                     "</error>");
+
+            ASSERT_EQUALS("", AnalyzerInformationTest::skipAnalysis(data.data(), data.size(), 100, errorList));
             ASSERT_EQUALS(1, errorList.size());
+            ASSERT_EQUALS("nullPointer", errorList.front().id);
+            ASSERT_EQUALS(2, errorList.front().callStack.size());
+            ASSERT_EQUALS("Null pointer dereference: ptr", errorList.front().shortMessage());
         }
 
         // Matching hash with no error (skip)
         {
             std::list<ErrorMessage> errorList;
-            tinyxml2::XMLDocument doc;
-
-            const tinyxml2::XMLError xmlError = doc.Parse(
-                "<?xml version=\"1.0\"?>"
-                "<analyzerinfo hash=\"100\">"
-                "</analyzerinfo>"
-                );
-            ASSERT_EQUALS(tinyxml2::XML_SUCCESS, xmlError);
+            const std::string data = getAnalyzerInfo(100, nullptr);
 
-            ASSERT_EQUALS("", AnalyzerInformationTest::skipAnalysis(doc, 100, errorList));
+            ASSERT_EQUALS("", AnalyzerInformationTest::skipAnalysis(data.data(), data.size(), 100, errorList));
             ASSERT_EQUALS(0, errorList.size());
         }
 
         // Different hash with normal error (don't skip)
         {
             std::list<ErrorMessage> errorList;
-            tinyxml2::XMLDocument doc;
+            const std::string data = getAnalyzerInfo(100,
+                                                     "<error id=\"nullPointer\" severity=\"error\" msg=\"Null pointer dereference: ptr\" verbose=\"Null pointer dereference: ptr\" cwe=\"476\" file0=\"test.c\">"
+                                                     "<location file=\"test.c\" line=\"4\" column=\"3\" info=\"Null pointer dereference\"/>"
+                                                     "</error>");
 
-            const tinyxml2::XMLError xmlError = doc.Parse(
-                "<?xml version=\"1.0\"?>"
-                "<analyzerinfo hash=\"100\">"
-                "<error id=\"nullPointer\" severity=\"error\" msg=\"Null pointer dereference: ptr\" verbose=\"Null pointer dereference: ptr\" cwe=\"476\" file0=\"test.c\">"
-                "<location file=\"test.c\" line=\"4\" column=\"3\" info=\"Null pointer dereference\"/>"
-                "<location file=\"test.c\" line=\"3\" column=\"12\" info=\"Assignment &apos;ptr=NULL&apos;, assigned value is 0\"/>"
-                "<symbol>ptr</symbol>"
-                "</error>"
-                "</analyzerinfo>"
-                );
-            ASSERT_EQUALS(tinyxml2::XML_SUCCESS, xmlError);
-
-            ASSERT_EQUALS("hash mismatch", AnalyzerInformationTest::skipAnalysis(doc, 99, errorList));
+            ASSERT_EQUALS("hash mismatch", AnalyzerInformationTest::skipAnalysis(data.data(), data.size(), 99, errorList));
             ASSERT_EQUALS(0, errorList.size());
         }
 
-        // Empty document (don't skip)
+        // Empty file (don't skip)
         {
             std::list<ErrorMessage> errorList;
-            tinyxml2::XMLDocument doc;
+            ASSERT_EQUALS("not an analyzer information file", AnalyzerInformationTest::skipAnalysis(nullptr, 0, 100, errorList));
+            ASSERT_EQUALS(0, errorList.size());
+        }
 
-            const tinyxml2::XMLError xmlError = doc.Parse("");
-            ASSERT_EQUALS(tinyxml2::XML_ERROR_EMPTY_DOCUMENT, xmlError);
+        // XML file from an older version (don't skip)
+        {
+            std::list<ErrorMessage> errorList;
+            const std::string data = "<?xml version=\"1.0\"?>"
+                                     "<analyzerinfo hash=\"100\">"
+                                     "</analyzerinfo>";
 
-            ASSERT_EQUALS("no root node found", AnalyzerInformationTest::skipAnalysis(doc, 100, errorList));
+            ASSERT_EQUALS("not an analyzer information file", AnalyzerInformationTest::skipAnalysis(data.data(), data.size(), 100, errorList));
             ASSERT_EQUALS(0, errorList.size());
         }
 
-        // Unexpected root node
+        // Unsupported version (don't skip)
         {
             std::list<ErrorMessage> errorList;
-            tinyxml2::XMLDocument doc;
+            std::string data = getAnalyzerInfo(100, nullptr);
+            data[4] = 99;
 
-            const tinyxml2::XMLError xmlError = doc.Parse(
-                "<?xml version=\"1.0\"?>"
-                "<ainfo/>"
-                );
-            ASSERT_EQUALS(tinyxml2::XML_SUCCESS, xmlError);
-
-            ASSERT_EQUALS("unexpected root node", AnalyzerInformationTest::skipAnalysis(doc, 99, errorList));
+            ASSERT_EQUALS("unsupported version", AnalyzerInformationTest::skipAnalysis(data.data(), data.size(), 100, errorList));
             ASSERT_EQUALS(0, errorList.size());
         }
 
-        // No 'hash' attribute found
+        // Truncated file (don't skip)
         {
             std::list<ErrorMessage> errorList;
-            tinyxml2::XMLDocument doc;
+            std::string data = getAnalyzerInfo(100,
+                                               "<error id=\"nullPointer\" severity=\"error\" msg=\"Null pointer dereference: ptr\" verbose=\"Null pointer dereference: ptr\" cwe=\"476\" file0=\"test.c\">"
+                                               "<location file=\"test.c\" line=\"4\" column=\"3\" info=\"Null pointer dereference\"/>"
+                                               "</error>");
 
-            const tinyxml2::XMLError xmlError = doc.Parse(
-                "<?xml version=\"1.0\"?>"
-                "<analyzerinfo/>"
-                );
-            ASSERT_EQUALS(tinyxml2::XML_SUCCESS, xmlError);
+            ASSERT_EQUALS("invalid entry", AnalyzerInformationTest::skipAnalysis(data.data(), data.size() - 1, 100, errorList));
+            ASSERT_EQUALS(0, errorList.size());
 
-            ASSERT_EQUALS("no 'hash' attribute found", AnalyzerInformationTest::skipAnalysis(doc, 99, errorList));
+            ASSERT_EQUALS("truncated index", AnalyzerInformationTest::skipAnalysis(data.data(), 30, 100, errorList));
             ASSERT_EQUALS(0, errorList.size());
         }
     }
+
+    void writeAndRead() const {
+        const ScopedFile filesTxt("files.txt", "a.a1:::a.c\n", "analyzerinfo-writeandread");
+        const std::string buildDir = "analyzerinfo-writeandread";
+
+        const ErrorMessage msg({ErrorMessage::FileLocation("a.c", 3, 4)}, "a.c", Severity::error, "Null pointer dereference: p", "nullPointer", Certainty::normal);
+
+        {
+            AnalyzerInformation analyzerInfo;
+            std::list<ErrorMessage> errors;
+            ASSERT(analyzerInfo.analyzeFile(buildDir, "a.c", "", 0, 100, errors));
+            analyzerInfo.reportErr(msg);
+            analyzerInfo.setFileInfo("CheckUnusedFunctions", "<functiondecl functionName=\"f\" lineNumber=\"1\"/>\n");
+            analyzerInfo.setFileInfo("ctu", "<function-call/>\n");
+        }
+
+        // the findings are loaded if the hash matches
+        {
+            AnalyzerInformation analyzerInfo;
+            std::list<ErrorMessage> errors;
+            ASSERT(!analyzerInfo.analyzeFile(buildDir, "a.c", "", 0, 100, errors));
+            ASSERT_EQUALS(1, errors.size());
+            ASSERT_EQUALS(msg.serialize(), errors.front().serialize());
+        }
+
+        // only the FileInfo of the requested check is passed to the handler
+        {
+            std::list<std::string> checks;
+            const auto handler = [&checks](const char* checkattr, const tinyxml2::XMLElement* e, const AnalyzerInformation::Info& filesTxtInfo) {
+                checks.emplace_back(std::string(checkattr) + ":" + e->FirstChildElement()->Name() + ":" + filesTxtInfo.sourceFile);
+            };
+            ASSERT_EQUALS("", AnalyzerInformation::processFilesTxt(buildDir, handler));
+            ASSERT_EQUALS(2, checks.size());
+            ASSERT_EQUALS("CheckUnusedFunctions:functiondecl:a.c", checks.front());
+            ASSERT_EQUALS("ctu:function-call:a.c", checks.back());
+
+            checks.clear();
+            ASSERT_EQUALS("", AnalyzerInformation::processFilesTxt(buildDir, handler, false, "ctu"));
+            ASSERT_EQUALS(1, checks.size());
+            ASSERT_EQUALS("ctu:function-call:a.c", checks.front());
+        }
+
+        // additional findings can be added to an existing file
+        {
+            AnalyzerInformation analyzerInfo;
+            analyzerInfo.reopen(buildDir, "a.c", "", 0);
+            analyzerInfo.reportErr(ErrorMessage({}, "a.c", Severity::information, "Unmatched suppression: id", "unmatchedSuppression", Certainty::normal));
+        }
+
+        {
+            std::ostringstream xml;
+            ASSERT_EQUALS("", AnalyzerInformation::exportXml(buildDir + "/a.a1", xml));
+            tinyxml2::XMLDocument doc;
+            ASSERT_EQUALS(tinyxml2::XML_SUCCESS, doc.Parse(xml.str().c_str()));
+            const tinyxml2::XMLElement * const root = doc.FirstChildElement("analyzerinfo");
+            ASSERT(root != nullptr);
+            ASSERT_EQUALS("100", root->Attribute("hash"));
+            std::list<std::string> elements;
+            for (const tinyxml2::XMLElement *e = root->FirstChildElement(); e; e = e->NextSiblingElement())
+                elements.emplace_back(std::string(e->Name()) + ":" + default_if_null(e->Attribute("id"), e->Attribute("check")));
+            ASSERT_EQUALS(4, elements.size());
+            ASSERT_EQUALS("error:nullPointer", elements.front());
+            ASSERT_EQUALS("error:unmatchedSuppression", elements.back());
+        }
+
+        std::remove((buildDir + "/a.a1").c_str());
+    }
+
+    void cacheFile() const {
+        const std::string cacheFile = AnalyzerInformation::getCacheFile("cache", "src/a.c", "", 100);
+        ASSERT_EQUALS(0, cacheFile.find("cache/"));
+        ASSERT(endsWith(cacheFile, ".a"));
+        ASSERT_EQUALS(cacheFile, AnalyzerInformation::getCacheFile("cache", "./src/a.c", "", 100));
+        ASSERT(cacheFile != AnalyzerInformation::getCacheFile("cache", "src/a.c", "", 101));
+        ASSERT(cacheFile != AnalyzerInformation::getCacheFile("cache", "src/b.c", "", 100));
+        ASSERT(cacheFile != AnalyzerInformation::getCacheFile("cache", "src/a.c", "A=1", 100));
+    }
+
+    void cacheDir() const {
+        const ScopedFile filesTxt1("files.txt", "a.a1:::a.c\n", "analyzerinfo-cachedir1");
+        const ScopedFile filesTxt2("files.txt", "a.a1:::a.c\n", "analyzerinfo-cachedir2");
+        const ScopedFile cacheDirFile("dummy", "", "analyzerinfo-cache");
+        const std::string cacheDir = "analyzerinfo-cache";
+        const std::string cacheFile = AnalyzerInformation::getCacheFile(cacheDir, "a.c", "", 100);
+
+        const ErrorMessage msg({ErrorMessage::FileLocation("a.c", 3, 4)}, "a.c", Severity::error, "Null pointer dereference: p", "nullPointer", Certainty::normal);
+
+        // the result of the first build dir is stored in the cache
+        {
+            AnalyzerInformation analyzerInfo(cacheDir);
+            std::list<ErrorMessage> errors;
+            ASSERT(analyzerInfo.analyzeFile("analyzerinfo-cachedir1", "a.c", "", 0, 100, errors));
+            analyzerInfo.reportErr(msg);
+            analyzerInfo.setFileInfo("ctu", "<function-call/>\n");
+        }
+        ASSERT(Path::isFile(cacheFile));
+
+        // ... and reused by the second one
+        {
+            AnalyzerInformation analyzerInfo(cacheDir);
+            std::list<ErrorMessage> errors;
+            ASSERT(!analyzerInfo.analyzeFile("analyzerinfo-cachedir2", "a.c", "", 0, 100, errors));
+            ASSERT_EQUALS(1, errors.size());
+            ASSERT_EQUALS(msg.serialize(), errors.front().serialize());
+        }
+
+        // the whole program analysis data is available in the second build dir
+        {
+            std::list<std::string> checks;
+            const auto handler = [&checks](const char* checkattr, const tinyxml2::XMLElement* /*e*/, const AnalyzerInformation::Info& /*filesTxtInfo*/) {
+                checks.emplace_back(checkattr);
+            };
+            ASSERT_EQUALS("", AnalyzerInformation::processFilesTxt("analyzerinfo-cachedir2", handler));
+            ASSERT_EQUALS(1, checks.size());
+            ASSERT_EQUALS("ctu", checks.front());
+        }
+
+        // a different hash is not found
+        {
+            AnalyzerInformation analyzerInfo(cacheDir);
+            std::list<ErrorMessage> errors;
+            ASSERT(analyzerInfo.analyzeFile("analyzerinfo-cachedir2", "a.c", "", 0, 101, errors));
+            ASSERT_EQUALS(0, errors.size());
+        }
+
+        std::remove("analyzerinfo-cachedir1/a.a1");
+        std::remove("analyzerinfo-cachedir2/a.a1");
+        std::remove(cacheFile.c_str());
+        std::remove(AnalyzerInformation::getCacheFile(cacheDir, "a.c", "", 101).c_str());
+    }
+
+    void dependencies() const {
+        const ScopedFile filesTxt("files.txt", "a.a1:::analyzerinfo-dependencies/a.c\n", "analyzerinfo-dependencies");
+        const ScopedFile source("a.c", "#include \"a.h\"\n", "analyzerinfo-dependencies-src");
+        const std::string buildDir = "analyzerinfo-dependencies";
+        const std::string header = "analyzerinfo-dependencies-src/a.h";
+        const std::string sourceFile = "analyzerinfo-dependencies/a.c";
+
+        const auto writeHeader = [&header](const char *content) {
+            std::ofstream fout(header);
+            fout << content;
+        };
+        writeHeader("int x;\n");
+
+        const ErrorMessage msg({ErrorMessage::FileLocation("a.c", 3, 4)}, "a.c", Severity::error, "Null pointer dereference: p", "nullPointer", Certainty::normal);
+
+        {
+            AnalyzerInformation analyzerInfo;
+            std::list<ErrorMessage> errors;
+            ASSERT(analyzerInfo.analyzeFile(buildDir, sourceFile, "", 0, 100, errors));
+            analyzerInfo.reportErr(msg);
+            analyzerInfo.setDependencies(1, {source.path(), header});
+        }
+
+        // nothing has changed
+        {
+            std::list<ErrorMessage> errors;
+            ASSERT(AnalyzerInformation::skipUnchanged(buildDir, sourceFile, "", 0, 1, errors));
+            ASSERT_EQUALS(1, errors.size());
+            ASSERT_EQUALS(msg.serialize(), errors.front().serialize());
+        }
+
+        // different options
+        {
+            std::list<ErrorMessage> errors;
+            ASSERT(!AnalyzerInformation::skipUnchanged(buildDir, sourceFile, "", 0, 2, errors));
+            ASSERT_EQUALS(0, errors.size());
+        }
+
+        // the header is rewritten with the same content
+        {
+            writeHeader("int x;\n");
+            std::list<ErrorMessage> errors;
+            ASSERT(AnalyzerInformation::skipUnchanged(buildDir, sourceFile, "", 0, 1, errors));
+            ASSERT_EQUALS(1, errors.size());
+        }
+
+        // the header is modified (with a different size since the modification time might be the same)
+        {
+            writeHeader("int xy;\n");
+            std::list<ErrorMessage> errors;
+            ASSERT(!AnalyzerInformation::skipUnchanged(buildDir, sourceFile, "", 0, 1, errors));
+            ASSERT_EQUALS(0, errors.size());
+        }
+
+        // the header is removed
+        {
+            std::remove(header.c_str());
+            std::list<ErrorMessage> errors;
+            ASSERT(!AnalyzerInformation::skipUnchanged(buildDir, sourceFile, "", 0, 1, errors));
+        }
+
+        // no dependencies are recorded if a file does not exist
+        {
+            AnalyzerInformation analyzerInfo;
+            std::list<ErrorMessage> errors;
+            ASSERT(analyzerInfo.analyzeFile(buildDir, sourceFile, "", 0, 101, errors));
+            analyzerInfo.setDependencies(1, {source.path(), header});
+        }
+        {
+            std::list<ErrorMessage> errors;
+            ASSERT(!AnalyzerInformation::skipUnchanged(buildDir, sourceFile, "", 0, 1, errors));
+        }
+
+        std::remove((buildDir + "/a.a1").c_str());
+    }
+
+    void timingsTxt() const {
+        const AnalyzerInformation::Timings timings{{"a.c", 12}, {"C:/dir/b.c 1", 3}};
+        const std::string timingsTxt = AnalyzerInformationTest::getTimingsTxt(timings);
+        ASSERT_EQUALS("3:C:/dir/b.c 1\n"
+                      "12:a.c\n", timingsTxt);
+
+        std::istringstream f(timingsTxt + "x:c.c\n"
+                                          "4:\n"
+                                          "d.c\n");
+        const AnalyzerInformation::Timings parsed = AnalyzerInformationTest::parseTimingsTxt(f);
+        ASSERT_EQUALS(2, parsed.size());
+        ASSERT_EQUALS(12, parsed.at("a.c"));
+        ASSERT_EQUALS(3, parsed.at("C:/dir/b.c 1"));
+    }
 };
 
 REGISTER_TEST(TestAnalyzerInformation)
@@ -368,12 +368,42 @@ private:
         TEST_CASE(checksMaxTime);
         TEST_CASE(checksMaxTime2);
         TEST_CASE(checksMaxTimeInvalid);
+#ifdef HAS_THREADING_MODEL_THREAD
+        TEST_CASE(checkersJobs);
+        TEST_CASE(checkersJobsZero);
+        TEST_CASE(checkersJobsTooBig);
+        TEST_CASE(checkersJobsInvalid);
+        TEST_CASE(configJobs);
+        TEST_CASE(configJobsZero);
+        TEST_CASE(configJobsTooBig);
+        TEST_CASE(configJobsInvalid);
+#else
+        TEST_CASE(checkersJobsNotSupported);
+        TEST_CASE(configJobsNotSupported);
+#endif
 #ifdef HAS_THREADING_MODEL_FORK
         TEST_CASE(loadAverage);
         TEST_CASE(loadAverage2);
         TEST_CASE(loadAverageInvalid);
+        TEST_CASE(maxMemory);
+        TEST_CASE(maxMemoryInvalid);
+        TEST_CASE(maxMemoryZero);
+#if defined(HAS_THREADING_MODEL_THREAD)
+        TEST_CASE(maxMemoryThreadExecutor);
+#endif
+        TEST_CASE(coordinator);
+        TEST_CASE(coordinatorEmpty);
+        TEST_CASE(coordinatorNoBuildDir);
+        TEST_CASE(coordinatorWorker);
+        TEST_CASE(worker);
+        TEST_CASE(workerEmpty);
+        TEST_CASE(workerNoBuildDir);
+        TEST_CASE(workerFiles);
 #else
         TEST_CASE(loadAverageNotSupported);
+        TEST_CASE(maxMemoryNotSupported);
+        TEST_CASE(coordinatorNotSupported);
+        TEST_CASE(workerNotSupported);
 #endif
         TEST_CASE(maxCtuDepth);
         TEST_CASE(maxCtuDepth2);
@@ -454,8 +484,10 @@ private:
 #if defined(HAS_THREADING_MODEL_FORK)
         TEST_CASE(executorProcess);
         TEST_CASE(executorProcessNoJobs);
+        TEST_CASE(executorProcessPool);
 #else
         TEST_CASE(executorProcessNotSupported);
+        TEST_CASE(executorProcessPoolNotSupported);
 #endif
         TEST_CASE(checkLevelDefault);
         TEST_CASE(checkLevelNormal);
@@ -537,6 +569,10 @@ private:
         TEST_CASE(cppcheckBuildDirMultiple);
         TEST_CASE(noCppcheckBuildDir);
         TEST_CASE(noCppcheckBuildDir2);
+        TEST_CASE(cacheDir);
+        TEST_CASE(cacheDirNonExistent);
+        TEST_CASE(cacheDirEmpty);
+        TEST_CASE(cacheDirNoBuildDir);
 
         TEST_CASE(invalidCppcheckCfg);
 
@@ -2448,6 +2484,78 @@ private:
         ASSERT_EQUALS("cppcheck: error: argument to '--checks-max-time=' is not valid - not an integer (invalid_argument).\n", logger->str());
     }
 
+#ifdef HAS_THREADING_MODEL_THREAD
+    void checkersJobs() {
+        REDIRECT;
+        const char * const argv[] = {"cppcheck", "--checkers-jobs=4", "file.cpp"};
+        ASSERT_EQUALS_ENUM(CmdLineParser::Result::Success, parseFromArgs(argv));
+        ASSERT_EQUALS(4, settings->checkersJobs);
+    }
+
+    void checkersJobsZero() {
+        REDIRECT;
+        const char * const argv[] = {"cppcheck", "--checkers-jobs=0", "file.cpp"};
+        ASSERT_EQUALS_ENUM(CmdLineParser::Result::Fail, parseFromArgs(argv));
+        ASSERT_EQUALS("cppcheck: error: argument for '--checkers-jobs' must be greater than 0.\n", logger->str());
+    }
+
+    void checkersJobsTooBig() {
+        REDIRECT;
+        const char * const argv[] = {"cppcheck", "--checkers-jobs=1025", "file.cpp"};
+        ASSERT_EQUALS_ENUM(CmdLineParser::Result::Fail, parseFromArgs(argv));
+        ASSERT_EQUALS("cppcheck: error: argument for '--checkers-jobs' is allowed to be 1024 at max.\n", logger->str());
+    }
+
+    void checkersJobsInvalid() {
+        REDIRECT;
+        const char * const argv[] = {"cppcheck", "--checkers-jobs=e", "file.cpp"};
+        ASSERT_EQUALS_ENUM(CmdLineParser::Result::Fail, parseFromArgs(argv));
+        ASSERT_EQUALS("cppcheck: error: argument to '--checkers-jobs=' is not valid - not an integer (invalid_argument).\n", logger->str());
+    }
+
+    void configJobs() {
+        REDIRECT;
+        const char * const argv[] = {"cppcheck", "--config-jobs=4", "file.cpp"};
+        ASSERT_EQUALS_ENUM(CmdLineParser::Result::Success, parseFromArgs(argv));
+        ASSERT_EQUALS(4, settings->configJobs);
+    }
+
+    void configJobsZero() {
+        REDIRECT;
+        const char * const argv[] = {"cppcheck", "--config-jobs=0", "file.cpp"};
+        ASSERT_EQUALS_ENUM(CmdLineParser::Result::Fail, parseFromArgs(argv));
+        ASSERT_EQUALS("cppcheck: error: argument for '--config-jobs' must be greater than 0.\n", logger->str());
+    }
+
+    void configJobsTooBig() {
+        REDIRECT;
+        const char * const argv[] = {"cppcheck", "--config-jobs=1025", "file.cpp"};
+        ASSERT_EQUALS_ENUM(CmdLineParser::Result::Fail, parseFromArgs(argv));
+        ASSERT_EQUALS("cppcheck: error: argument for '--config-jobs' is allowed to be 1024 at max.\n", logger->str());
+    }
+
+    void configJobsInvalid() {
+        REDIRECT;
+        const char * const argv[] = {"cppcheck", "--config-jobs=e", "file.cpp"};
+        ASSERT_EQUALS_ENUM(CmdLineParser::Result::Fail, parseFromArgs(argv));
+        ASSERT_EQUALS("cppcheck: error: argument to '--config-jobs=' is not valid - not an integer (invalid_argument).\n", logger->str());
+    }
+#else
+    void checkersJobsNotSupported() {
+        REDIRECT;
+        const char * const argv[] = {"cppcheck", "--checkers-jobs=4", "file.cpp"};
+        ASSERT_EQUALS_ENUM(CmdLineParser::Result::Fail, parseFromArgs(argv));
+        ASSERT_EQUALS("cppcheck: error: Option --checkers-jobs cannot be used as Cppcheck has not been built with a respective threading model.\n", logger->str());
+    }
+
+    void configJobsNotSupported() {
+        REDIRECT;
+        const char * const argv[] = {"cppcheck", "--config-jobs=4", "file.cpp"};
+        ASSERT_EQUALS_ENUM(CmdLineParser::Result::Fail, parseFromArgs(argv));
+        ASSERT_EQUALS("cppcheck: error: Option --config-jobs cannot be used as Cppcheck has not been built with a respective threading model.\n", logger->str());
+    }
+#endif
+
 #ifdef HAS_THREADING_MODEL_FORK
     void loadAverage() {
         REDIRECT;
@@ -2469,6 +2577,92 @@ private:
         ASSERT_EQUALS_ENUM(CmdLineParser::Result::Fail, parseFromArgs(argv));
         ASSERT_EQUALS("cppcheck: error: argument to '-l' is not valid - not an integer (invalid_argument).\n", logger->str());
     }
+
+    void maxMemory() {
+        REDIRECT;
+        const char * const argv[] = {"cppcheck", "--max-memory=4096", "file.cpp"};
+        ASSERT_EQUALS_ENUM(CmdLineParser::Result::Success, parseFromArgs(argv));
+        ASSERT_EQUALS(4096, settings->maxMemory);
+    }
+
+    void maxMemoryInvalid() {
+        REDIRECT;
+        const char * const argv[] = {"cppcheck", "--max-memory=one", "file.cpp"};
+        ASSERT_EQUALS_ENUM(CmdLineParser::Result::Fail, parseFromArgs(argv));
+        ASSERT_EQUALS("cppcheck: error: argument to '--max-memory=' is not valid - not an integer (invalid_argument).\n", logger->str());
+    }
+
+    void maxMemoryZero() {
+        REDIRECT;
+        const char * const argv[] = {"cppcheck", "--max-memory=0", "file.cpp"};
+        ASSERT_EQUALS_ENUM(CmdLineParser::Result::Fail, parseFromArgs(argv));
+        ASSERT_EQUALS("cppcheck: error: argument for '--max-memory' must be greater than 0.\n", logger->str());
+    }
+
+#if defined(HAS_THREADING_MODEL_THREAD)
+    void maxMemoryThreadExecutor() {
+        REDIRECT;
+        const char * const argv[] = {"cppcheck", "-j2", "--executor=thread", "--max-memory=4096", "file.cpp"};
+        ASSERT_EQUALS_ENUM(CmdLineParser::Result::Success, parseFromArgs(argv));
+        ASSERT_EQUALS("cppcheck: '--max-memory' has no effect with the thread executor.\n", logger->str());
+    }
+#endif
+
+    void coordinator() {
+        REDIRECT;
+        const char * const argv[] = {"cppcheck", "--coordinator=127.0.0.1:4000", "--cppcheck-build-dir=.", "file.cpp"};
+        ASSERT_EQUALS_ENUM(CmdLineParser::Result::Success, parseFromArgs(argv));
+        ASSERT_EQUALS("127.0.0.1:4000", settings->coordinator);
+    }
+
+    void coordinatorEmpty() {
+        REDIRECT;
+        const char * const argv[] = {"cppcheck", "--coordinator=", "--cppcheck-build-dir=.", "file.cpp"};
+        ASSERT_EQUALS_ENUM(CmdLineParser::Result::Fail, parseFromArgs(argv));
+        ASSERT_EQUALS("cppcheck: error: no address has been specified for --coordinator\n", logger->str());
+    }
+
+    void coordinatorNoBuildDir() {
+        REDIRECT;
+        const char * const argv[] = {"cppcheck", "--coordinator=unix:cppcheck.sock", "file.cpp"};
+        ASSERT_EQUALS_ENUM(CmdLineParser::Result::Fail, parseFromArgs(argv));
+        ASSERT_EQUALS("cppcheck: error: --coordinator requires --cppcheck-build-dir.\n", logger->str());
+    }
+
+    void coordinatorWorker() {
+        REDIRECT;
+        const char * const argv[] = {"cppcheck", "--coordinator=unix:cppcheck.sock", "--worker=unix:cppcheck.sock", "--cppcheck-build-dir=.", "file.cpp"};
+        ASSERT_EQUALS_ENUM(CmdLineParser::Result::Fail, parseFromArgs(argv));
+        ASSERT_EQUALS("cppcheck: error: --coordinator cannot be used in conjunction with --worker.\n", logger->str());
+    }
+
+    void worker() {
+        REDIRECT;
+        const char * const argv[] = {"cppcheck", "--worker=unix:cppcheck.sock", "--cppcheck-build-dir=."};
+        ASSERT_EQUALS_ENUM(CmdLineParser::Result::Success, parseFromArgs(argv));
+        ASSERT_EQUALS("unix:cppcheck.sock", settings->worker);
+    }
+
+    void workerEmpty() {
+        REDIRECT;
+        const char * const argv[] = {"cppcheck", "--worker=", "--cppcheck-build-dir=."};
+        ASSERT_EQUALS_ENUM(CmdLineParser::Result::Fail, parseFromArgs(argv));
+        ASSERT_EQUALS("cppcheck: error: no address has been specified for --worker\n", logger->str());
+    }
+
+    void workerNoBuildDir() {
+        REDIRECT;
+        const char * const argv[] = {"cppcheck", "--worker=unix:cppcheck.sock"};
+        ASSERT_EQUALS_ENUM(CmdLineParser::Result::Fail, parseFromArgs(argv));
+        ASSERT_EQUALS("cppcheck: error: --worker requires --cppcheck-build-dir.\n", logger->str());
+    }
+
+    void workerFiles() {
+        REDIRECT;
+        const char * const argv[] = {"cppcheck", "--worker=unix:cppcheck.sock", "--cppcheck-build-dir=.", "file.cpp"};
+        ASSERT_EQUALS_ENUM(CmdLineParser::Result::Fail, parseFromArgs(argv));
+        ASSERT_EQUALS("cppcheck: error: --worker cannot be used in conjunction with source files.\n", logger->str());
+    }
 #else
     void loadAverageNotSupported() {
         REDIRECT;
@@ -2476,6 +2670,27 @@ private:
         ASSERT_EQUALS_ENUM(CmdLineParser::Result::Fail, parseFromArgs(argv));
         ASSERT_EQUALS("cppcheck: error: Option -l cannot be used as Cppcheck has not been built with fork threading model.\n", logger->str());
     }
+
+    void maxMemoryNotSupported() {
+        REDIRECT;
+        const char * const argv[] = {"cppcheck", "--max-memory=4096", "file.cpp"};
+        ASSERT_EQUALS_ENUM(CmdLineParser::Result::Fail, parseFromArgs(argv));
+        ASSERT_EQUALS("cppcheck: error: Option --max-memory cannot be used as Cppcheck has not been built with fork threading model.\n", logger->str());
+    }
+
+    void coordinatorNotSupported() {
+        REDIRECT;
+        const char * const argv[] = {"cppcheck", "--coordinator=unix:cppcheck.sock", "file.cpp"};
+        ASSERT_EQUALS_ENUM(CmdLineParser::Result::Fail, parseFromArgs(argv));
+        ASSERT_EQUALS("cppcheck: error: Option --coordinator cannot be used as Cppcheck has not been built with fork threading model.\n", logger->str());
+    }
+
+    void workerNotSupported() {
+        REDIRECT;
+        const char * const argv[] = {"cppcheck", "--worker=unix:cppcheck.sock"};
+        ASSERT_EQUALS_ENUM(CmdLineParser::Result::Fail, parseFromArgs(argv));
+        ASSERT_EQUALS("cppcheck: error: Option --worker cannot be used as Cppcheck has not been built with fork threading model.\n", logger->str());
+    }
 #endif
 
     void maxCtuDepth() {
@@ -3123,6 +3338,13 @@ private:
         ASSERT_EQUALS_ENUM(Settings::ExecutorType::Process, settings->executor);
         ASSERT_EQUALS("cppcheck: '--executor' has no effect as only a single job will be used.\n", logger->str());
     }
+
+    void executorProcessPool() {
+        REDIRECT;
+        const char * const argv[] = {"cppcheck", "-j2", "--executor=process-pool", "file.cpp"};
+        ASSERT_EQUALS_ENUM(CmdLineParser::Result::Success, parseFromArgs(argv));
+        ASSERT_EQUALS_ENUM(Settings::ExecutorType::ProcessPool, settings->executor);
+    }
 #else
     void executorProcessNotSupported() {
         REDIRECT;
@@ -3130,6 +3352,13 @@ private:
         ASSERT_EQUALS_ENUM(CmdLineParser::Result::Fail, parseFromArgs(argv));
         ASSERT_EQUALS("cppcheck: error: executor type 'process' cannot be used as Cppcheck has not been built with a respective threading model.\n", logger->str());
     }
+
+    void executorProcessPoolNotSupported() {
+        REDIRECT;
+        const char * const argv[] = {"cppcheck", "-j2", "--executor=process-pool", "file.cpp"};
+        ASSERT_EQUALS_ENUM(CmdLineParser::Result::Fail, parseFromArgs(argv));
+        ASSERT_EQUALS("cppcheck: error: executor type 'process-pool' cannot be used as Cppcheck has not been built with a respective threading model.\n", logger->str());
+    }
 #endif
 
     // the CLI default to --check-level=normal
@@ -3753,6 +3982,34 @@ private:
         ASSERT(settings->buildDir.empty());
     }
 
+    void cacheDir() {
+        REDIRECT;
+        const char * const argv[] = {"cppcheck", "--cppcheck-build-dir=.", "--cache-dir=./", "file.cpp"};
+        ASSERT_EQUALS_ENUM(CmdLineParser::Result::Success, parseFromArgs(argv));
+        ASSERT_EQUALS(".", settings->cacheDir);
+    }
+
+    void cacheDirNonExistent() {
+        REDIRECT;
+        const char * const argv[] = {"cppcheck", "--cppcheck-build-dir=.", "--cache-dir=non-existent-path", "file.cpp"};
+        ASSERT_EQUALS_ENUM(CmdLineParser::Result::Fail, parseFromArgs(argv));
+        ASSERT_EQUALS("cppcheck: error: Directory 'non-existent-path' specified by --cache-dir argument has to be existent.\n", logger->str());
+    }
+
+    void cacheDirEmpty() {
+        REDIRECT;
+        const char * const argv[] = {"cppcheck", "--cppcheck-build-dir=.", "--cache-dir=", "file.cpp"};
+        ASSERT_EQUALS_ENUM(CmdLineParser::Result::Fail, parseFromArgs(argv));
+        ASSERT_EQUALS("cppcheck: error: no path has been specified for --cache-dir\n", logger->str());
+    }
+
+    void cacheDirNoBuildDir() {
+        REDIRECT;
+        const char * const argv[] = {"cppcheck", "--cache-dir=.", "file.cpp"};
+        ASSERT_EQUALS_ENUM(CmdLineParser::Result::Fail, parseFromArgs(argv));
+        ASSERT_EQUALS("cppcheck: error: --cache-dir requires --cppcheck-build-dir.\n", logger->str());
+    }
+
     void invalidCppcheckCfg() {
         REDIRECT;
         ScopedFile file(Path::join(Path::getPathFromFilename(Path::getCurrentExecutablePath("")), "cppcheck.cfg"),
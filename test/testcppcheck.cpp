@@ -18,6 +18,7 @@
 
 #include "addoninfo.h"
 #include "color.h"
+#include "config.h"
 #include "cppcheck.h"
 #include "errorlogger.h"
 #include "errortypes.h"
@@ -84,6 +85,10 @@ private:
         TEST_CASE(checkPlistOutput);
         TEST_CASE(premiumResultsCache);
         TEST_CASE(purgedConfiguration);
+#ifdef HAS_THREADING_MODEL_THREAD
+        TEST_CASE(checkersJobs);
+        TEST_CASE(configJobs);
+#endif
     }
 
     void getErrorMessages() const {
@@ -621,6 +626,99 @@ private:
                       it->toString(false, templateFormat, ""));
     }
 
+#ifdef HAS_THREADING_MODEL_THREAD
+    std::list<std::string> checkWithSettings(const std::string &file, const Settings &s) const
+    {
+        Suppressions supprs;
+        ErrorLogger2 errorLogger;
+        CppCheck cppcheck(s, supprs, errorLogger, nullptr, false, {});
+        cppcheck.check(FileWithDetails(file, Path::identify(file, false), 0));
+        std::list<std::string> errors;
+        for (const ErrorMessage &msg : errorLogger.errmsgs)
+            errors.push_back(msg.toString(false, templateFormat, ""));
+        return errors;
+    }
+
+    std::list<std::string> checkWithCheckersJobs(const std::string &file, unsigned int checkersJobs) const
+    {
+        const auto s = dinit(Settings,
+                             $.templateFormat = templateFormat,
+                                 $.checkersJobs = checkersJobs,
+                                 $.severity.enable (Severity::warning);
+                             $.severity.enable (Severity::style));
+        return checkWithSettings(file, s);
+    }
+
+    void checkersJobs() const
+    {
+        ScopedFile test_file("checkersjobs.cpp",
+                             "struct S {\n"
+                             "    int i;\n"
+                             "    S() {}\n"
+                             "};\n"
+                             "void f(int *p) {\n"
+                             "    int a[10];\n"
+                             "    a[10] = 0;\n"
+                             "    if (p) {}\n"
+                             "    *p = 0;\n"
+                             "    int x = 1;\n"
+                             "    x = x;\n"
+                             "}\n");
+
+        const std::list<std::string> serial = checkWithCheckersJobs(test_file.path(), 1);
+        ASSERT(serial.size() > 3);
+        // the output needs to be identical to the serial execution including the order
+        ASSERT_EQUALS(joinErrors(serial), joinErrors(checkWithCheckersJobs(test_file.path(), 4)));
+        ASSERT_EQUALS(joinErrors(serial), joinErrors(checkWithCheckersJobs(test_file.path(), 1024)));
+    }
+
+    std::list<std::string> checkWithConfigJobs(const std::string &file, unsigned int configJobs) const
+    {
+        const auto s = dinit(Settings,
+                             $.templateFormat = templateFormat,
+                                 $.configJobs = configJobs,
+                                 $.force = true,
+                                 $.debugwarnings = true,
+                                 $.severity.enable (Severity::warning);
+                             $.severity.enable (Severity::style);
+                             $.severity.enable (Severity::information));
+        return checkWithSettings(file, s);
+    }
+
+    void configJobs() const
+    {
+        ScopedFile test_file("configjobs.cpp",
+                             "#ifdef A\n"
+                             "void f1() { int a[10]; a[10] = 0; }\n"
+                             "#endif\n"
+                             "#ifdef B\n"
+                             "void f2(int *p) { if (p) {} *p = 0; }\n"
+                             "#endif\n"
+                             "#ifdef C\n"
+                             "#error C\n"
+                             "#endif\n"
+                             "#ifdef D\n"
+                             "#endif\n"
+                             "void f3() { int x = 1; x = x; }\n");
+
+        const std::list<std::string> serial = checkWithConfigJobs(test_file.path(), 1);
+        ASSERT(std::any_of(serial.cbegin(), serial.cend(), [](const std::string &e) {
+            return e.find("[purgedConfiguration]") != std::string::npos;
+        }));
+        // the output needs to be identical to the serial execution including the order
+        ASSERT_EQUALS(joinErrors(serial), joinErrors(checkWithConfigJobs(test_file.path(), 2)));
+        ASSERT_EQUALS(joinErrors(serial), joinErrors(checkWithConfigJobs(test_file.path(), 1024)));
+    }
+
+    static std::string joinErrors(const std::list<std::string> &errors)
+    {
+        std::string s;
+        for (const std::string &e : errors)
+            s += e + '\n';
+        return s;
+    }
+#endif
+
     // TODO: test suppressions
     // TODO: test all with FS
 };
@@ -27,10 +27,12 @@
 #include "standards.h"
 #include "suppressions.h"
 
+#include <chrono>
 #include <list>
 #include <stdexcept>
 #include <string>
 #include <utility>
+#include <vector>
 
 class DummyExecutor : public Executor
 {
@@ -48,6 +50,36 @@ public:
     {
         return hasToLog(msg);
     }
+
+    std::vector<Job> getJobs_()
+    {
+        return getJobs();
+    }
+
+    void addTiming_(const Job &job, std::chrono::milliseconds elapsed)
+    {
+        addTiming(job, elapsed);
+    }
+
+    void writeTimings_()
+    {
+        writeTimings();
+    }
+
+    std::size_t estimatePeakMemory_(const Job &job) const
+    {
+        return estimatePeakMemory(job);
+    }
+
+    void addPeakMemory_(const Job &job, std::size_t peakMemory)
+    {
+        addPeakMemory(job, peakMemory);
+    }
+
+    void writePeakMemory_()
+    {
+        writePeakMemory();
+    }
 };
 
 class TestExecutor : public TestFixture {
@@ -57,6 +89,9 @@ public:
 private:
     void run() override {
         TEST_CASE(hasToLogSimple);
+        TEST_CASE(jobsBySize);
+        TEST_CASE(jobsByTiming);
+        TEST_CASE(peakMemoryEstimate);
     }
 
     void hasToLogSimple() {
@@ -83,6 +118,127 @@ private:
 
         ASSERT(executor.hasToLog_(msg));
     }
+
+    void jobsBySize() {
+        const std::list<FileWithDetails> files{
+            FileWithDetails{"a.c", Standards::Language::C, 10},
+            FileWithDetails{"b.c", Standards::Language::C, 30},
+            FileWithDetails{"c.c", Standards::Language::C, 10},
+            FileWithDetails{"d.c", Standards::Language::C, 20}
+        };
+        const std::list<FileSettings> fileSettings;
+        const Settings settings;
+        Suppressions supprs;
+        DummyExecutor executor(files, fileSettings, settings, supprs, *this);
+
+        const std::vector<Executor::Job> jobs = executor.getJobs_();
+        ASSERT_EQUALS(4, jobs.size());
+        // the order of files with the same cost is kept
+        ASSERT_EQUALS("b.c", jobs[0].name);
+        ASSERT_EQUALS("d.c", jobs[1].name);
+        ASSERT_EQUALS("a.c", jobs[2].name);
+        ASSERT_EQUALS("c.c", jobs[3].name);
+    }
+
+    void jobsByTiming() {
+        ScopedFile buildDir("dummy", "", "jobs-builddir");
+        ScopedFile timingsTxt("jobs-builddir/timings.txt", "");
+
+        const std::list<FileWithDetails> files;
+        std::list<FileSettings> fileSettings;
+        fileSettings.emplace_back("a.c", Standards::Language::C, 10);
+        fileSettings.emplace_back("b.c", Standards::Language::C, 30);
+        fileSettings.emplace_back("c.c", Standards::Language::C, 20);
+        fileSettings.emplace_back("d.c", Standards::Language::C, 100);
+        const auto settings = dinit(Settings, $.buildDir = "jobs-builddir");
+        Suppressions supprs;
+
+        {
+            DummyExecutor executor(files, fileSettings, settings, supprs, *this);
+            const std::vector<Executor::Job> jobs = executor.getJobs_();
+            ASSERT_EQUALS(4, jobs.size());
+            ASSERT_EQUALS("d.c ", jobs[0].name);
+            for (const Executor::Job &job : jobs) {
+                if (job.name == "a.c ")
+                    executor.addTiming_(job, std::chrono::milliseconds{500});
+                else if (job.name == "b.c ")
+                    executor.addTiming_(job, std::chrono::milliseconds{30});
+                else if (job.name == "c.c ")
+                    executor.addTiming_(job, std::chrono::milliseconds{200});
+            }
+            executor.writeTimings_();
+        }
+
+        {
+            DummyExecutor executor(files, fileSettings, settings, supprs, *this);
+            const std::vector<Executor::Job> jobs = executor.getJobs_();
+            ASSERT_EQUALS(4, jobs.size());
+            // estimated based on the recorded time per size
+            ASSERT_EQUALS("d.c ", jobs[0].name);
+            ASSERT_EQUALS(1216, jobs[0].cost);
+            ASSERT_EQUALS("a.c ", jobs[1].name);
+            ASSERT_EQUALS(500, jobs[1].cost);
+            ASSERT_EQUALS("c.c ", jobs[2].name);
+            ASSERT_EQUALS("b.c ", jobs[3].name);
+        }
+    }
+
+    void peakMemoryEstimate() {
+        ScopedFile buildDir("dummy", "", "peakmemory-builddir");
+        ScopedFile peakMemoryTxt("peakmemory-builddir/peakmemory.txt", "");
+
+        const std::list<FileWithDetails> files{
+            FileWithDetails{"a.c", Standards::Language::C, 10},
+            FileWithDetails{"b.c", Standards::Language::C, 30},
+            FileWithDetails{"c.c", Standards::Language::C, 100}
+        };
+        const std::list<FileSettings> fileSettings;
+        const auto settings = dinit(Settings, $.buildDir = "peakmemory-builddir");
+        Suppressions supprs;
+
+        {
+            DummyExecutor executor(files, fileSettings, settings, supprs, *this);
+            const std::vector<Executor::Job> jobs = executor.getJobs_();
+            ASSERT_EQUALS(3, jobs.size());
+            // nothing recorded yet
+            for (const Executor::Job &job : jobs)
+                ASSERT_EQUALS(0, executor.estimatePeakMemory_(job));
+            for (const Executor::Job &job : jobs) {
+                if (job.name == "a.c")
+                    executor.addPeakMemory_(job, 2000);
+                else if (job.name == "b.c")
+                    executor.addPeakMemory_(job, 4000);
+            }
+            // estimated based on the memory usage per size recorded in this run
+            for (const Executor::Job &job : jobs) {
+                if (job.name == "c.c")
+                    ASSERT_EQUALS(15000, executor.estimatePeakMemory_(job));
+            }
+            executor.writePeakMemory_();
+        }
+
+        {
+            DummyExecutor executor(files, fileSettings, settings, supprs, *this);
+            const std::vector<Executor::Job> jobs = executor.getJobs_();
+            for (const Executor::Job &job : jobs) {
+                if (job.name == "a.c")
+                    ASSERT_EQUALS(2000, executor.estimatePeakMemory_(job));
+                else if (job.name == "b.c")
+                    ASSERT_EQUALS(4000, executor.estimatePeakMemory_(job));
+                else
+                    ASSERT_EQUALS(15000, executor.estimatePeakMemory_(job));
+            }
+            // a new record replaces the previous one
+            for (const Executor::Job &job : jobs) {
+                if (job.name == "b.c")
+                    executor.addPeakMemory_(job, 1000);
+            }
+            for (const Executor::Job &job : jobs) {
+                if (job.name == "c.c")
+                    ASSERT_EQUALS(7500, executor.estimatePeakMemory_(job));
+            }
+        }
+    }
 };
 
 REGISTER_TEST(TestExecutor)
@@ -0,0 +1,122 @@
+/*
+ * Cppcheck - A tool for static C/C++ code analysis
+ * Copyright (C) 2007-2026 Cppcheck team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "fixture.h"
+#include "headercache.h"
+#include "helpers.h"
+
+#include <fstream>
+#include <list>
+#include <string>
+#include <vector>
+
+#include <simplecpp.h>
+
+class TestHeaderCache : public TestFixture {
+public:
+    TestHeaderCache() : TestFixture("TestHeaderCache") {}
+
+private:
+    void run() override {
+        TEST_CASE(load);
+        TEST_CASE(modified);
+        TEST_CASE(lexError);
+        TEST_CASE(missing);
+        TEST_CASE(prewarm);
+    }
+
+    void load() const {
+        HeaderCache &cache = HeaderCache::instance();
+        cache.clear();
+        const ScopedFile header("headercache.h", "// comment\nint x;\n#define A 1\n");
+
+        std::vector<std::string> files1{"a.c"};
+        simplecpp::OutputList outputList;
+        const simplecpp::TokenList tokens1 = cache.load(header.path(), files1, &outputList);
+        ASSERT_EQUALS(1, cache.size());
+        ASSERT_EQUALS(2, files1.size());
+        ASSERT_EQUALS(header.path(), files1[1]);
+        ASSERT_EQUALS(1, tokens1.cfront()->location.fileIndex);
+        ASSERT_EQUALS("\n#line 1 \"headercache.h\"\n// comment\nint x ;\n# define A 1", tokens1.stringify());
+
+        // a second translation unit gets its own copy
+        std::vector<std::string> files2{"b.c", "b.h", header.path()};
+        const simplecpp::TokenList tokens2 = cache.load(header.path(), files2, &outputList);
+        ASSERT_EQUALS(1, cache.size());
+        ASSERT_EQUALS(3, files2.size());
+        ASSERT_EQUALS(2, tokens2.cfront()->location.fileIndex);
+        ASSERT_EQUALS(tokens1.stringify(), tokens2.stringify());
+        ASSERT(tokens1.cfront() != tokens2.cfront());
+        ASSERT(outputList.empty());
+    }
+
+    void modified() const {
+        HeaderCache &cache = HeaderCache::instance();
+        cache.clear();
+        const ScopedFile header("headercache.h", "int x;\n");
+
+        std::vector<std::string> files;
+        ASSERT_EQUALS("int x ;", cache.load(header.path(), files, nullptr).stringify());
+        {
+            std::ofstream fout(header.path());
+            fout << "int y;\n";
+        }
+        ASSERT_EQUALS("int y ;", cache.load(header.path(), files, nullptr).stringify());
+        ASSERT_EQUALS(1, cache.size());
+        ASSERT_EQUALS(1, files.size());
+    }
+
+    void lexError() const {
+        HeaderCache &cache = HeaderCache::instance();
+        cache.clear();
+        const ScopedFile header("headercache.h", "const char *s = \"abc\n");
+
+        std::vector<std::string> files{"a.c"};
+        simplecpp::OutputList outputList;
+        (void)cache.load(header.path(), files, &outputList);
+        ASSERT_EQUALS(0, cache.size());
+        ASSERT_EQUALS(1, outputList.size());
+        ASSERT_EQUALS(1, outputList.front().location.fileIndex);
+    }
+
+    void missing() const {
+        HeaderCache &cache = HeaderCache::instance();
+        cache.clear();
+
+        std::vector<std::string> files{"a.c"};
+        simplecpp::OutputList outputList;
+        (void)cache.load("headercache-missing.h", files, &outputList);
+        ASSERT_EQUALS(0, cache.size());
+        ASSERT_EQUALS(1, outputList.size());
+        ASSERT_EQUALS(simplecpp::Output::FILE_NOT_FOUND, outputList.front().type);
+    }
+
+    void prewarm() const {
+        HeaderCache &cache = HeaderCache::instance();
+        cache.clear();
+        const ScopedFile header1("headercache1.h", "#include \"headercache2.h\"\n");
+        const ScopedFile header2("headercache2.h", "int x;\n", "headercache-inc");
+        const ScopedFile source("headercache.c", "#ifdef A\n#include \"headercache1.h\"\n#endif\n#include <missing.h>\n");
+
+        // all includes are loaded regardless of the configuration
+        cache.prewarm(source.path(), {"headercache-inc"}, {});
+        ASSERT_EQUALS(2, cache.size());
+    }
+};
+
+REGISTER_TEST(TestHeaderCache)
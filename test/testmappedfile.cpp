@@ -0,0 +1,77 @@
+/*
+ * Cppcheck - A tool for static C/C++ code analysis
+ * Copyright (C) 2007-2026 Cppcheck team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "fixture.h"
+#include "helpers.h"
+#include "mappedfile.h"
+
+#include <string>
+
+class TestMappedFile : public TestFixture {
+public:
+    TestMappedFile() : TestFixture("TestMappedFile") {}
+
+private:
+    void run() override {
+        TEST_CASE(open);
+        TEST_CASE(empty);
+        TEST_CASE(missing);
+        TEST_CASE(reopen);
+    }
+
+    void open() const {
+        const ScopedFile file("mappedfile.c", "int x;\r\nint y;\n");
+        MappedFile mapped;
+        bool notFound = true;
+        ASSERT(mapped.open(file.path(), notFound));
+        ASSERT(!notFound);
+        ASSERT_EQUALS("int x;\r\nint y;\n", std::string(mapped.data(), mapped.size()));
+        mapped.close();
+        ASSERT(mapped.data() == nullptr);
+        ASSERT_EQUALS(0, mapped.size());
+    }
+
+    void empty() const {
+        const ScopedFile file("mappedfile.c", "");
+        MappedFile mapped;
+        bool notFound = true;
+        ASSERT(mapped.open(file.path(), notFound));
+        ASSERT(!notFound);
+        ASSERT_EQUALS(0, mapped.size());
+    }
+
+    void missing() const {
+        MappedFile mapped;
+        bool notFound = false;
+        ASSERT(!mapped.open("mappedfile-missing.c", notFound));
+        ASSERT(notFound);
+        ASSERT_EQUALS(0, mapped.size());
+    }
+
+    void reopen() const {
+        const ScopedFile file1("mappedfile1.c", "int x;\n");
+        const ScopedFile file2("mappedfile2.c", "int y;\n");
+        MappedFile mapped;
+        bool notFound = false;
+        ASSERT(mapped.open(file1.path(), notFound));
+        ASSERT(mapped.open(file2.path(), notFound));
+        ASSERT_EQUALS("int y;\n", std::string(mapped.data(), mapped.size()));
+    }
+};
+
+REGISTER_TEST(TestMappedFile)
@@ -38,6 +38,7 @@
 #include <list>
 #include <map>
 #include <set>
+#include <sstream>
 #include <stdexcept>
 #include <string>
 #include <utility>
@@ -386,6 +387,8 @@ private:
         TEST_CASE(writeLocations);
 
         TEST_CASE(pragmaAsm);
+
+        TEST_CASE(lexBuffer);
     }
 
     template<size_t size>
@@ -3200,6 +3203,38 @@ private:
         const char code[] = "#pragma asm";
         ASSERT_THROW_INTERNAL(getcodeforcfg(settingsDefault, *this, code, "", "test.cpp"), InternalError::SYNTAX);
     }
+
+    static std::string lexed(const simplecpp::TokenList &tokens)
+    {
+        std::string ret;
+        for (const simplecpp::Token *tok = tokens.cfront(); tok; tok = tok->next)
+            ret += std::to_string(tok->location.line) + ':' + std::to_string(tok->location.col) + ' ' + tok->str() + '\n';
+        return ret;
+    }
+
+    void lexBuffer()
+    {
+        // runs of whitespace, name, comment and string characters are read directly from a buffer
+        const std::string code = "int   a_long_identifier_with_more_than_16_chars = 0x1234'5678;\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t// comment\n"
+                                 "/* a block comment which is longer than 16 characters *\\/ **/ x;\r\n"
+                                 "/* a multiline\r\n comment with * and / in it */ y;\r"
+                                 "const char *s = \"a string literal which is long enough \\\" \\\\\\\\ with escapes\";\n"
+                                 "#define M \"a string literal which \\\r\ncontinues\"\n"
+                                 "char c = 'x'; $name_with_a_dollar_sign_and_digits_0123456789                                z\n";
+
+        std::vector<std::string> files1;
+        std::istringstream istr(code);
+        const simplecpp::TokenList fromStream(istr, files1, "test.c");
+
+        std::vector<std::string> files2;
+        const simplecpp::TokenList fromBuffer({code.data(), code.size()}, files2, "test.c");
+        ASSERT_EQUALS(lexed(fromStream), lexed(fromBuffer));
+
+        ScopedFile file("lexBuffer.c", code);
+        std::vector<std::string> files3;
+        const simplecpp::TokenList fromFile(file.path(), files3);
+        ASSERT_EQUALS(lexed(fromStream), lexed(fromFile));
+    }
 };
 
 REGISTER_TEST(TestPreprocessor)
@@ -20,6 +20,8 @@
 #include "fixture.h"
 
 #ifdef HAS_THREADING_MODEL_FORK
+#include "analyzerinfo.h"
+#include "cppcheck.h"
 #include "filesettings.h"
 #include "helpers.h"
 #include "processexecutor.h"
@@ -36,29 +38,39 @@
 #include <string>
 #include <utility>
 #include <vector>
+
+#include <csignal>
+#include <dirent.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
 #endif // HAS_THREADING_MODEL_FORK
 
 class TestProcessExecutorBase : public TestFixture {
 public:
-    TestProcessExecutorBase(const char * const name, bool useFS)
+    TestProcessExecutorBase(const char * const name, bool useFS, bool usePool)
         : TestFixture(name)
 #ifdef HAS_THREADING_MODEL_FORK
         , useFS(useFS)
+        , usePool(usePool)
 #endif // HAS_THREADING_MODEL_FORK
     {
         (void)useFS;
+        (void)usePool;
     }
 
 private:
 #ifdef HAS_THREADING_MODEL_FORK
     /*const*/ Settings settings;
     bool useFS;
+    bool usePool;
 
     std::string fprefix() const
     {
+        std::string prefix = usePool ? "processpool" : "process";
         if (useFS)
-            return "processfs";
-        return "process";
+            prefix += "fs";
+        return prefix;
     }
 
     struct CheckOptions
@@ -98,6 +110,7 @@ private:
 
         /*const*/ Settings s = settings;
         s.jobs = jobs;
+        s.executor = usePool ? Settings::ExecutorType::ProcessPool : Settings::ExecutorType::Process;
         s.showtime = opt.showtime;
         s.quiet = opt.quiet;
         if (opt.plistOutput)
@@ -308,13 +321,174 @@ private:
 
 class TestProcessExecutorFiles : public TestProcessExecutorBase {
 public:
-    TestProcessExecutorFiles() : TestProcessExecutorBase("TestProcessExecutorFiles", false) {}
+    TestProcessExecutorFiles() : TestProcessExecutorBase("TestProcessExecutorFiles", false, false) {}
 };
 
 class TestProcessExecutorFS : public TestProcessExecutorBase {
 public:
-    TestProcessExecutorFS() : TestProcessExecutorBase("TestProcessExecutorFS", true) {}
+    TestProcessExecutorFS() : TestProcessExecutorBase("TestProcessExecutorFS", true, false) {}
+};
+
+class TestProcessExecutorPoolFiles : public TestProcessExecutorBase {
+public:
+    TestProcessExecutorPoolFiles() : TestProcessExecutorBase("TestProcessExecutorPoolFiles", false, true) {}
+};
+
+class TestProcessExecutorPoolFS : public TestProcessExecutorBase {
+public:
+    TestProcessExecutorPoolFS() : TestProcessExecutorBase("TestProcessExecutorPoolFS", true, true) {}
+};
+
+class TestProcessExecutorDistributed : public TestFixture {
+public:
+    TestProcessExecutorDistributed() : TestFixture("TestProcessExecutorDistributed") {}
+
+private:
+    void run() override {
+        mNewTemplate = true;
+#ifdef HAS_THREADING_MODEL_FORK
+        TEST_CASE(files);
+        TEST_CASE(fileSettings);
+        TEST_CASE(wholeProgram);
+#endif // HAS_THREADING_MODEL_FORK
+    }
+
+#ifdef HAS_THREADING_MODEL_FORK
+    // removes the files written by the analysis so the directory can be removed by ScopedFile
+    static void removeAnalysisFiles(const std::string &dir)
+    {
+        DIR *d = opendir(dir.c_str());
+        if (!d)
+            return;
+        while (const dirent *entry = readdir(d)) {
+            const std::string name = entry->d_name;
+            if (name != "." && name != ".." && name != "dummy")
+                std::remove((dir + "/" + name).c_str());
+        }
+        closedir(d);
+    }
+
+    /**
+     * Check the files by handing them out to local workers connected via a Unix socket.
+     * Performs the whole program analysis like the CLI if requested.
+     * @return the result of the coordinator
+     */
+    unsigned int check(unsigned int workers, const std::list<FileWithDetails> &files, const std::list<FileSettings> &fileSettings, bool wholeProgram = false) {
+        const std::string address = "unix:processdistributed.sock";
+
+        Settings s;
+        s.quiet = true;
+        s.templateFormat = "{callstack}: ({severity}) {inconclusive:inconclusive: }{message}";
+
+        // NOLINTNEXTLINE(performance-unnecessary-value-param)
+        auto executeFn = [](std::string,std::vector<std::string>,std::string,std::string&){
+            return EXIT_SUCCESS;
+        };
+
+        std::vector<std::unique_ptr<ScopedFile>> workerDirs;
+        std::vector<pid_t> pids;
+        for (unsigned int i = 0; i < workers; ++i) {
+            workerDirs.emplace_back(new ScopedFile("dummy", "", "processdistributed-worker" + std::to_string(i)));
+            const pid_t pid = fork();
+            if (pid == 0) {
+                Settings workerSettings = s;
+                workerSettings.worker = address;
+                workerSettings.buildDir = "processdistributed-worker" + std::to_string(i);
+                Suppressions supprs;
+                ProcessExecutor executor({}, {}, workerSettings, supprs, *this, nullptr, executeFn);
+                _exit(executor.work());
+            }
+            pids.push_back(pid);
+        }
+
+        ScopedFile buildDir("dummy", "", "processdistributed-builddir");
+        s.coordinator = address;
+        s.buildDir = "processdistributed-builddir";
+        std::list<std::string> fileNames;
+        for (const FileWithDetails &f : files)
+            fileNames.push_back(f.path());
+        AnalyzerInformation::writeFilesTxt(s.buildDir, fileNames, fileSettings);
+
+        Suppressions supprs;
+        ProcessExecutor executor(files, fileSettings, s, supprs, *this, nullptr, executeFn);
+        const unsigned int result = executor.check();
+
+        // a worker might still be waiting for the coordinator if all files have already been handed out to the others
+        for (const pid_t pid : pids) {
+            kill(pid, SIGTERM);
+            waitpid(pid, nullptr, 0);
+        }
+
+        if (wholeProgram) {
+            CppCheck cppcheck(s, supprs, *this, nullptr, true, executeFn);
+            (void)cppcheck.analyseWholeProgram(s.buildDir, files, fileSettings, "");
+        }
+
+        removeAnalysisFiles(s.buildDir);
+        for (unsigned int i = 0; i < workers; ++i)
+            removeAnalysisFiles("processdistributed-worker" + std::to_string(i));
+        return result;
+    }
+
+    void files() {
+        const std::string code = "void f()\n"
+                                 "{\n"
+                                 "  (void)(*((int*)0));\n"
+                                 "}";
+        std::vector<std::unique_ptr<ScopedFile>> scopedfiles;
+        std::list<FileWithDetails> files;
+        for (int i = 1; i <= 5; ++i) {
+            scopedfiles.emplace_back(new ScopedFile("processdistributed_" + std::to_string(i) + ".c", code));
+            files.emplace_back(scopedfiles.back()->path(), Standards::Language::C, code.size());
+        }
+        ASSERT_EQUALS(5, check(2, files, {}));
+        ASSERT_EQUALS(5, cppcheck::count_all_of(errout_str(), "(error) Null pointer dereference: (int*)0"));
+    }
+
+    void fileSettings() {
+        const ScopedFile file("processdistributed_fs.c",
+                              "void f()\n"
+                              "{\n"
+                              "#if defined(A) && !defined(B)\n"
+                              "  (void)(*((int*)0));\n"
+                              "#endif\n"
+                              "}");
+        std::list<FileSettings> fileSettings;
+        fileSettings.emplace_back(file.path(), Standards::Language::C, 0);
+        fileSettings.back().defines = "A=1";
+        fileSettings.back().undefs.insert("B");
+        fileSettings.back().includePaths.emplace_back("inc/");
+        ASSERT_EQUALS(1, check(1, {}, fileSettings));
+        ASSERT_EQUALS("[processdistributed_fs.c:4:12]: (error) Null pointer dereference: (int*)0 [nullPointer]\n", errout_str());
+    }
+
+    void wholeProgram() {
+        // the function needs to be declared in a shared header so the calls can be matched across the files
+        const ScopedFile header("processdistributed_ctu.h",
+                                "void f(int *p);\n");
+        const ScopedFile file1("processdistributed_ctu1.c",
+                               "#include \"processdistributed_ctu.h\"\n"
+                               "void f(int *p) {\n"
+                               "  *p = 0;\n"
+                               "}");
+        const ScopedFile file2("processdistributed_ctu2.c",
+                               "#include \"processdistributed_ctu.h\"\n"
+                               "void g() {\n"
+                               "  f(0);\n"
+                               "}");
+        const std::list<FileWithDetails> files{
+            FileWithDetails{file1.path(), Standards::Language::C, 0},
+            FileWithDetails{file2.path(), Standards::Language::C, 0}
+        };
+        // the analyzer information is sent back by the workers
+        ASSERT_EQUALS(0, check(2, files, {}, true));
+        ASSERT_EQUALS("[processdistributed_ctu2.c:3:4] -> [processdistributed_ctu1.c:3:4]: (error) Null pointer dereference: p [ctunullpointer]\n", errout_str());
+    }
+#endif // HAS_THREADING_MODEL_FORK
 };
 
 REGISTER_TEST(TestProcessExecutorFiles)
 REGISTER_TEST(TestProcessExecutorFS)
+REGISTER_TEST(TestProcessExecutorPoolFiles)
+REGISTER_TEST(TestProcessExecutorPoolFS)
+REGISTER_TEST(TestProcessExecutorDistributed)
@@ -0,0 +1,81 @@
+/*
+ * Cppcheck - A tool for static C/C++ code analysis
+ * Copyright (C) 2007-2026 Cppcheck team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "fixture.h"
+#include "helpers.h"
+#include "standards.h"
+#include "stringpool.h"
+#include "token.h"
+#include "tokenlist.h"
+
+#include <string>
+
+class TestStringPool : public TestFixture {
+public:
+    TestStringPool() : TestFixture("TestStringPool") {}
+
+private:
+    void run() override {
+        TEST_CASE(intern);
+        TEST_CASE(predefined);
+        TEST_CASE(tokens);
+        TEST_CASE(standaloneToken);
+    }
+
+    void intern() const {
+        StringPool pool;
+        const std::string *x = pool.intern("x");
+        ASSERT_EQUALS("x", *x);
+        ASSERT(x == pool.intern(std::string("x")));
+        ASSERT(x != pool.intern("y"));
+        ASSERT_EQUALS(2, pool.size());
+    }
+
+    void predefined() const {
+        StringPool pool1;
+        StringPool pool2;
+        ASSERT(StringPool::predefined("if") != nullptr);
+        ASSERT(StringPool::predefined("<<=") != nullptr);
+        ASSERT(StringPool::predefined("x") == nullptr);
+        ASSERT(pool1.intern("if") == StringPool::predefined("if"));
+        ASSERT(pool1.intern("if") == pool2.intern("if"));
+        ASSERT(pool1.intern("x") != pool2.intern("x"));
+        ASSERT_EQUALS(1, pool1.size());
+    }
+
+    void tokens() const {
+        const SimpleTokenList tokenlist("x = x + 1 ; if ( x ) { }");
+        const Token *x1 = tokenlist.front();
+        const Token *x2 = x1->tokAt(2);
+        ASSERT_EQUALS("x", x2->str());
+        ASSERT(&x1->str() == &x2->str());
+        ASSERT(&Token::findsimplematch(x1, "if")->str() == StringPool::predefined("if"));
+    }
+
+    void standaloneToken() const {
+        const SimpleTokenList tokenlist("int x ;");
+        Token *tok = new Token(tokenlist.front());
+        tok->str("long");
+        ASSERT(&tok->str() == StringPool::predefined("long"));
+        tok->str("standalone");
+        ASSERT(&tok->str() == StringPool::internShared("standalone"));
+        delete tok;
+    }
+};
+
+REGISTER_TEST(TestStringPool)
@@ -323,6 +323,7 @@ private:
         TEST_CASE(namespaces3);  // #3854 - unknown macro
         TEST_CASE(namespaces4);
         TEST_CASE(namespaces5); // #13967
+        TEST_CASE(findRecordInNestedList);
         TEST_CASE(needInitialization);
 
         TEST_CASE(tryCatch1);
@@ -3336,6 +3337,36 @@ private:
         ASSERT_EQUALS("test", scope->nestedIn->className);
     }
 
+    void findRecordInNestedList() {
+        GET_SYMBOL_DB("namespace N {\n"
+                      "    void S() {}\n"
+                      "    struct S {};\n"
+                      "}\n"
+                      "namespace N {\n"
+                      "    struct T {};\n"
+                      "}\n"
+                      "N::S s;\n"
+                      "N::T t;");
+
+        const Scope *global = &db->scopeList.front();
+        const Scope *scopeN = global->findRecordInNestedList("N");
+        ASSERT(scopeN && scopeN->type == ScopeType::eNamespace);
+        if (!scopeN)
+            return;
+
+        // the function scope with the same name is skipped
+        const Scope *scopeS = scopeN->findRecordInNestedList("S");
+        ASSERT(scopeS && scopeS->type == ScopeType::eStruct);
+        ASSERT_EQUALS(2U, scopeN->findInNestedList("S").size());
+        ASSERT(scopeN->findInNestedListRecursive("S") && scopeN->findInNestedListRecursive("S")->type == ScopeType::eFunction);
+        // the reopened namespace shares the scope
+        ASSERT(scopeN->findRecordInNestedList("T") && scopeN->findRecordInNestedList("T")->type == ScopeType::eStruct);
+        ASSERT(!scopeN->findRecordInNestedList("X"));
+
+        ASSERT(db->getVariableFromVarId(1) && db->getVariableFromVarId(1)->typeScope() == scopeS);
+        ASSERT(db->getVariableFromVarId(2) && db->getVariableFromVarId(2)->type() && db->getVariableFromVarId(2)->type()->name() == "T");
+    }
+
     void needInitialization() {
         {
             GET_SYMBOL_DB_DBG("template <typename T>\n" // #10259
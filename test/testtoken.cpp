@@ -90,6 +90,7 @@ private:
         TEST_CASE(matchOr);
         TEST_CASE(matchOp);
         TEST_CASE(matchConstOp);
+        TEST_CASE(matchLiteral);
 
         TEST_CASE(isArithmeticalOp);
         TEST_CASE(isOp);
@@ -133,6 +134,8 @@ private:
         TEST_CASE(update_property_info_replace); // #13743
 
         TEST_CASE(varid_reset);
+
+        TEST_CASE(coldData);
     }
 
     void nextprevious() const {
@@ -870,6 +873,47 @@ private:
         }
     }
 
+    void matchLiteral() const {
+        // A string literal is parsed the first time it is used - the result must be the same as when the pattern is interpreted
+        const SimpleTokenList code("if ( x ) { } else { }");
+        const Token *tok = code.front();
+        const auto interpreted = [&](const char *pattern) {
+            return Token::Match(tok, pattern);
+        };
+
+        ASSERT_EQUALS(true, Token::Match(tok, "if ( %name% ) { } else"));
+        ASSERT_EQUALS(true, interpreted("if ( %name% ) { } else"));
+        ASSERT_EQUALS(false, Token::Match(tok, "if ( %name% ) { } !!else"));
+        ASSERT_EQUALS(false, interpreted("if ( %name% ) { } !!else"));
+        ASSERT_EQUALS(true, Token::Match(tok, "while|if|  (  x|y"));
+        ASSERT_EQUALS(true, interpreted("while|if|  (  x|y"));
+        ASSERT_EQUALS(true, Token::Match(tok, "while| if %num%| ( %name%|%num% ) {|["));
+        ASSERT_EQUALS(true, interpreted("while| if %num%| ( %name%|%num% ) {|["));
+        ASSERT_EQUALS(true, Token::Match(tok, "if [;(] x [)]]"));
+        ASSERT_EQUALS(true, interpreted("if [;(] x [)]]"));
+        ASSERT_EQUALS(false, Token::Match(tok, "if [;)] x"));
+        ASSERT_EQUALS(false, interpreted("if [;)] x"));
+        ASSERT_EQUALS(true, Token::Match(tok, "if !!) %var%|x"));
+        ASSERT_EQUALS(true, interpreted("if !!) %var%|x"));
+        ASSERT_EQUALS(false, Token::Match(tok, "i|ifx ("));
+        ASSERT_EQUALS(false, interpreted("i|ifx ("));
+
+        // patterns which are always interpreted
+        ASSERT_EQUALS(true, Token::Match(tok, "if||while ("));
+        ASSERT_EQUALS(true, interpreted("if||while ("));
+        ASSERT_EQUALS(true, Token::Match(tok, "!! ("));
+        ASSERT_EQUALS(true, interpreted("!! ("));
+
+        // the end of the tokens
+        const Token *last = tok;
+        while (last->next())
+            last = last->next();
+        ASSERT_EQUALS(true, Token::Match(last, "} !!else !!if"));
+        ASSERT_EQUALS(false, Token::Match(last, "} %any%|"));
+        ASSERT_EQUALS(false, Token::Match(last, "} else|"));
+        ASSERT_THROW_INTERNAL_EQUALS((void)Token::Match(tok, "if %varid%"),INTERNAL,"Internal error. Token::Match called with varid 0.");
+    }
+
 
     void isArithmeticalOp() const {
         for (auto test_op = arithmeticalOps.cbegin(); test_op != arithmeticalOps.cend(); ++test_op) {
@@ -1515,6 +1559,50 @@ private:
         assert_tok(&tok, Token::Type::eType, /*l=*/ false, /*std=*/ true);
     }
 #undef assert_tok
+
+    void coldData() const
+    {
+        auto tokensFrontBack = std::make_shared<TokensFrontBack>();
+        auto *token = new Token(list, std::move(tokensFrontBack));
+        token->str("x");
+        Token *tok2 = token->insertToken("y");
+
+        ASSERT_EQUALS(-1, token->templateArgFileIndex());
+        ASSERT_EQUALS(-1, token->templateArgLineNumber());
+        ASSERT_EQUALS(-1, token->templateArgColumn());
+        ASSERT(!token->hasAttributeAlignas());
+        ASSERT(!token->hasAttributeCleanup());
+        ASSERT_EQUALS("", token->getAttributeCleanup());
+        ASSERT(!token->hasCppcheckAttributes());
+        ASSERT(!token->scopeInfo());
+        ASSERT(!token->templateSimplifierPointers());
+        token->scopeInfo(nullptr);
+        token->templateArgFrom(nullptr);
+        ASSERT(!token->scopeInfo());
+
+        tok2->linenr(3);
+        tok2->column(7);
+        token->templateArgFrom(tok2);
+        token->addAttributeAlignas("8");
+        token->addAttributeCleanup("f");
+        token->setCppcheckAttribute(Token::CppcheckAttributesType::LOW, 2);
+        ASSERT_EQUALS(3, token->templateArgLineNumber());
+        ASSERT_EQUALS(7, token->templateArgColumn());
+        ASSERT_EQUALS(1, token->getAttributeAlignas().size());
+        ASSERT_EQUALS("f", token->getAttributeCleanup());
+        ASSERT(token->hasCppcheckAttributes());
+        MathLib::bigint value = 0;
+        ASSERT(token->getCppcheckAttribute(Token::CppcheckAttributesType::LOW, value));
+        ASSERT_EQUALS(2, value);
+
+        // the data follows the token when it is swapped
+        token->swapWithNext();
+        ASSERT(!token->hasAttributeCleanup());
+        ASSERT_EQUALS("f", tok2->getAttributeCleanup());
+        ASSERT_EQUALS(3, tok2->templateArgLineNumber());
+
+        TokenList::deleteTokens(token);
+    }
 };
 
 REGISTER_TEST(TestToken)
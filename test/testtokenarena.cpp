@@ -0,0 +1,119 @@
+/*
+ * Cppcheck - A tool for static C/C++ code analysis
+ * Copyright (C) 2007-2026 Cppcheck team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "fixture.h"
+#include "helpers.h"
+#include "standards.h"
+#include "token.h"
+#include "tokenarena.h"
+#include "tokenlist.h"
+
+#include <cstdint>
+#include <memory>
+
+class TestTokenArena : public TestFixture {
+public:
+    TestTokenArena() : TestFixture("TestTokenArena") {}
+
+private:
+    void run() override {
+        TEST_CASE(reuse);
+        TEST_CASE(alignment);
+        TEST_CASE(release);
+        TEST_CASE(heap);
+        TEST_CASE(tokenList);
+        TEST_CASE(outliveList);
+    }
+
+    void reuse() const {
+        auto tokensFrontBack = std::make_shared<TokensFrontBack>();
+        TokenArena &arena = *tokensFrontBack->arena;
+
+        void *p1 = TokenArena::allocate(40, &arena);
+        void *p2 = TokenArena::allocate(40, &arena);
+        void *p3 = TokenArena::allocate(100, &arena);
+        ASSERT_EQUALS(3, arena.size());
+        ASSERT_EQUALS(2, arena.chunks());
+
+        TokenArena::deallocate(p1);
+        ASSERT_EQUALS(2, arena.size());
+        ASSERT(p1 == TokenArena::allocate(40, &arena));
+
+        TokenArena::deallocate(p1);
+        TokenArena::deallocate(p2);
+        TokenArena::deallocate(p3);
+        ASSERT_EQUALS(0, arena.size());
+    }
+
+    void alignment() const {
+        auto tokensFrontBack = std::make_shared<TokensFrontBack>();
+        TokenArena &arena = *tokensFrontBack->arena;
+
+        void *p1 = TokenArena::allocate(1, &arena);
+        void *p2 = TokenArena::allocate(1, &arena);
+        ASSERT_EQUALS(0, reinterpret_cast<std::uintptr_t>(p1) % alignof(std::max_align_t));
+        ASSERT_EQUALS(0, reinterpret_cast<std::uintptr_t>(p2) % alignof(std::max_align_t));
+        TokenArena::deallocate(p1);
+        TokenArena::deallocate(p2);
+    }
+
+    void release() const {
+        // the arena is only destroyed after the last object has been deallocated
+        auto tokensFrontBack = std::make_shared<TokensFrontBack>();
+        void *p = TokenArena::allocate(40, tokensFrontBack->arena);
+        tokensFrontBack.reset();
+        TokenArena::deallocate(p);
+    }
+
+    void heap() const {
+        void *p = TokenArena::allocate(40, nullptr);
+        ASSERT(p != nullptr);
+        TokenArena::deallocate(p);
+        TokenArena::deallocate(nullptr);
+    }
+
+    void tokenList() const {
+        TokenList tokenlist(settingsDefault, Standards::Language::CPP);
+        tokenlist.addtoken("a", 1, 1, false);
+        tokenlist.addtoken("b", 1, 3, false);
+        tokenlist.addtoken("c", 1, 5, false);
+
+        // the slot of a deleted token is reused
+        Token *a = tokenlist.front();
+        const Token *b = a->next();
+        a->deleteNext();
+        ASSERT_EQUALS("a c", a->stringifyList(nullptr, false));
+        ASSERT(b == a->insertToken("d"));
+        ASSERT_EQUALS("a d c", a->stringifyList(nullptr, false));
+    }
+
+    void outliveList() const {
+        // the token keeps the arena alive while it is being deleted
+        const TokenList tokenlist(settingsDefault, Standards::Language::CPP);
+        Token *tok;
+        {
+            auto tokensFrontBack = std::make_shared<TokensFrontBack>();
+            tok = new (*tokensFrontBack->arena) Token(tokenlist, tokensFrontBack);
+        }
+        tok->str("a");
+        ASSERT_EQUALS("a", tok->str());
+        delete tok;
+    }
+};
+
+REGISTER_TEST(TestTokenArena)
@@ -0,0 +1,127 @@
+/*
+ * Cppcheck - A tool for static C/C++ code analysis
+ * Copyright (C) 2007-2026 Cppcheck team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "errortypes.h"
+#include "fixture.h"
+#include "helpers.h"
+#include "standards.h"
+#include "token.h"
+#include "tokenindex.h"
+#include "tokenlist.h"
+
+class TestTokenIndex : public TestFixture {
+public:
+    TestTokenIndex() : TestFixture("TestTokenIndex") {}
+
+private:
+    void run() override {
+        TEST_CASE(addtoken);
+        TEST_CASE(str);
+        TEST_CASE(deleteToken);
+        TEST_CASE(swapWithNext);
+        TEST_CASE(standalone);
+        TEST_CASE(notIndexed);
+    }
+
+    void addtoken() const {
+        TokenList tokenlist(settingsDefault, Standards::Language::CPP);
+        tokenlist.addtoken("typedef", 1, 1, false);
+        tokenlist.addtoken("int", 1, 9, false);
+        tokenlist.addtoken("x", 1, 13, false);
+        tokenlist.addtoken(";", 1, 14, false);
+        tokenlist.addtoken("typedef", 2, 1, false);
+
+        const TokenIndex &index = tokenlist.index();
+        ASSERT_EQUALS(2, index.tokens("typedef").size());
+        ASSERT(index.tokens("typedef").count(tokenlist.front()) == 1);
+        ASSERT(index.tokens("typedef").count(tokenlist.back()) == 1);
+        ASSERT_EQUALS(false, index.contains("using"));
+
+        tokenlist.front()->insertToken("using");
+        ASSERT_EQUALS(true, index.contains("using"));
+        ASSERT(index.tokens("using").count(tokenlist.front()->next()) == 1);
+    }
+
+    void str() const {
+        TokenList tokenlist(settingsDefault, Standards::Language::CPP);
+        tokenlist.addtoken("template", 1, 1, false);
+        const TokenIndex &index = tokenlist.index();
+
+        tokenlist.front()->str("goto");
+        ASSERT_EQUALS(false, index.contains("template"));
+        ASSERT_EQUALS(1, index.tokens("goto").size());
+
+        tokenlist.front()->str("x");
+        ASSERT_EQUALS(false, index.contains("goto"));
+    }
+
+    void deleteToken() const {
+        TokenList tokenlist(settingsDefault, Standards::Language::CPP);
+        tokenlist.addtoken("a", 1, 1, false);
+        tokenlist.addtoken("asm", 1, 3, false);
+        tokenlist.addtoken("b", 1, 7, false);
+        const TokenIndex &index = tokenlist.index();
+
+        // deleteThis() moves the data of the next token into this one
+        tokenlist.front()->next()->deleteThis();
+        ASSERT_EQUALS("a b", tokenlist.front()->stringifyList(nullptr, false));
+        ASSERT_EQUALS(false, index.contains("asm"));
+
+        tokenlist.front()->insertToken("asm");
+        tokenlist.front()->deleteNext();
+        ASSERT_EQUALS(false, index.contains("asm"));
+
+        tokenlist.front()->insertToken("using");
+        tokenlist.front()->deleteThis();
+        ASSERT_EQUALS("using b", tokenlist.front()->stringifyList(nullptr, false));
+        ASSERT(index.tokens("using").count(tokenlist.front()) == 1);
+
+        tokenlist.deallocateTokens();
+        ASSERT_EQUALS(false, index.contains("using"));
+    }
+
+    void swapWithNext() const {
+        TokenList tokenlist(settingsDefault, Standards::Language::CPP);
+        tokenlist.addtoken("typedef", 1, 1, false);
+        tokenlist.addtoken("using", 1, 9, false);
+        const TokenIndex &index = tokenlist.index();
+
+        tokenlist.front()->swapWithNext();
+        ASSERT(index.tokens("using").count(tokenlist.front()) == 1);
+        ASSERT(index.tokens("typedef").count(tokenlist.back()) == 1);
+        ASSERT_EQUALS(1, index.tokens("using").size());
+        ASSERT_EQUALS(1, index.tokens("typedef").size());
+    }
+
+    void standalone() const {
+        // the copies created by the checks are not part of the list
+        TokenList tokenlist(settingsDefault, Standards::Language::CPP);
+        tokenlist.addtoken("x", 1, 1, false);
+        Token copy(tokenlist.front());
+        copy.str("goto");
+        ASSERT_EQUALS(false, tokenlist.index().contains("goto"));
+    }
+
+    void notIndexed() const {
+        const TokenList tokenlist(settingsDefault, Standards::Language::CPP);
+        ASSERT_THROW_INTERNAL_EQUALS((void)tokenlist.index().contains("x"), INTERNAL, "Internal error. TokenIndex: 'x' is not indexed.");
+        ASSERT_THROW_INTERNAL_EQUALS((void)tokenlist.index().contains("if"), INTERNAL, "Internal error. TokenIndex: 'if' is not indexed.");
+    }
+};
+
+REGISTER_TEST(TestTokenIndex)
@@ -500,7 +500,9 @@ private:
         SimpleTokenizer tokenizer(s ? *s : settings, *this, cpp);
         ASSERT_LOC(tokenizer.tokenize(code), file, line);
         const Token *tok = Token::findmatch(tokenizer.tokens(), tokstr);
-        return tok ? tok->values() : std::list<ValueFlow::Value>();
+        if (!tok)
+            return {};
+        return {tok->values().cbegin(), tok->values().cend()};
     }
 
     std::list<ValueFlow::Value> tokenValues_(const char* file, int line, const char code[], const char tokstr[], ValueFlow::Value::ValueType vt) {
@@ -520,7 +522,7 @@ private:
         const Token* tok = Token::findmatch(tokenizer.tokens(), tokstr);
         if (!tok)
             return "";
-        const std::list<ValueFlow::Value>& values = tok->values();
+        const ValueFlow::ValueList& values = tok->values();
         const auto it = std::find_if(values.cbegin(), values.cend(), [](const ValueFlow::Value& v) {
             return v.isContainerSizeValue() && v.container;
         });
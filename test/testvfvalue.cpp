@@ -26,6 +26,9 @@ public:
 private:
     void run() override {
         TEST_CASE(toString);
+        TEST_CASE(valueList);
+        TEST_CASE(valueListCopy);
+        TEST_CASE(subexpressions);
     }
 
     void toString() const {
@@ -43,6 +46,76 @@ private:
             ASSERT_EQUALS("1e-13", v.toString());
         }
     }
+
+    static std::string str(const ValueFlow::ValueList &values) {
+        std::string ret;
+        for (const ValueFlow::Value &v : values)
+            ret += (ret.empty() ? "" : ",") + v.toString();
+        return ret;
+    }
+
+    void valueList() const {
+        ValueFlow::ValueList values;
+        ASSERT(values.empty());
+        values.push_back(ValueFlow::Value(1));
+        values.emplace_back(2);
+        ASSERT_EQUALS("1,2", str(values));
+        // more values than fit in the list itself
+        values.push_front(ValueFlow::Value(0));
+        values.emplace_back(3);
+        values.emplace_back(4);
+        ASSERT_EQUALS("0,1,2,3,4", str(values));
+        ASSERT_EQUALS(5, values.size());
+        ASSERT_EQUALS(0, values.front().intvalue);
+        ASSERT_EQUALS(4, values.back().intvalue);
+
+        values.remove_if([](const ValueFlow::Value &v) {
+            return v.intvalue % 2 == 1;
+        });
+        ASSERT_EQUALS("0,2,4", str(values));
+        ASSERT_EQUALS(4, values.erase(values.cbegin() + 1)->intvalue);
+        ASSERT_EQUALS("0,4", str(values));
+        (void)values.insert(values.cbegin() + 1, ValueFlow::Value(3));
+        ASSERT_EQUALS("0,3,4", str(values));
+        values.clear();
+        ASSERT(values.empty());
+        values.emplace_back(5);
+        ASSERT_EQUALS("5", str(values));
+    }
+
+    void valueListCopy() const {
+        const ValueFlow::ValueList small{ValueFlow::Value(1)};
+        const ValueFlow::ValueList large{ValueFlow::Value(1), ValueFlow::Value(2), ValueFlow::Value(3)};
+        {
+            ValueFlow::ValueList values(small);
+            ASSERT_EQUALS("1", str(values));
+            values = large;
+            ASSERT_EQUALS("1,2,3", str(values));
+            values = small;
+            ASSERT_EQUALS("1", str(values));
+        }
+        {
+            ValueFlow::ValueList values(large);
+            ValueFlow::ValueList moved(std::move(values));
+            ASSERT_EQUALS("1,2,3", str(moved));
+            values = small; // cppcheck-suppress accessMoved
+            ValueFlow::ValueList moved2;
+            moved2 = std::move(values);
+            ASSERT_EQUALS("1", str(moved2));
+        }
+        ASSERT_EQUALS("1,2,3", str(large));
+    }
+
+    void subexpressions() const {
+        ValueFlow::Value v1;
+        ASSERT(!v1.subexpressions);
+        v1.addSubexpression("a");
+        ValueFlow::Value v2(v1);
+        ASSERT(v1.subexpressions == v2.subexpressions);
+        v2.addSubexpression("b");
+        ASSERT_EQUALS(1, v1.subexpressions->size());
+        ASSERT_EQUALS(2, v2.subexpressions->size());
+    }
 };
 
 REGISTER_TEST(TestValueFlowValue)